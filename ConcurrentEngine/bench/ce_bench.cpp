@@ -0,0 +1,400 @@
+// ce_bench.cpp
+// 各 Scheduler 的微基準：提交吞吐量、取出吞吐量、空任務往返延遲，以及 1..N 條 producer / consumer 的擴展性
+// 結果輸出為 JSON 或 CSV，供之後每次修改 Scheduler 時比較
+//
+//   ce_bench [--format=json|csv] [--out=FILE] [--tasks=N] [--samples=N]
+//            [--max-threads=N] [--schedulers=fifo,priority,dag,lockfree,workstealing,legacy] [--quick]
+#include <threadPool/threadPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef CE_BUILD_LEGACY_POOL
+#include "../legacy/oldThreadpool.hpp"
+#endif
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+struct Options
+{
+    std::string format = "json";
+    std::string out;
+    size_t tasks = 200000;
+    size_t samples = 20000;
+    int maxThreads = static_cast<int>(std::max(2u, std::thread::hardware_concurrency()));
+    std::vector<std::string> schedulers = {"fifo", "priority", "dag", "lockfree", "workstealing", "legacy"};
+};
+
+struct Result
+{
+    std::string scheduler;
+    std::string scenario;
+    int producers = 0;
+    int consumers = 0;
+    size_t tasks = 0;
+    double seconds = 0;
+    double opsPerSec = 0;
+    double p50Ns = 0;
+    double p99Ns = 0;
+    double meanNs = 0;
+};
+
+void waitFor(const std::atomic<size_t>& counter, size_t target)
+{
+    while (counter.load(std::memory_order_acquire) < target)
+        std::this_thread::yield();
+}
+
+double percentile(std::vector<double>& values, double p)
+{
+    if (values.empty()) return 0;
+    size_t idx = static_cast<size_t>(p * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + static_cast<std::ptrdiff_t>(idx), values.end());
+    return values[idx];
+}
+
+// ---- Pool adapters：統一 start / post / stop 介面 ----
+
+template<typename SchedulerT>
+class EnginePool
+{
+public:
+    // capacity 只用於固定容量的 LockFreeFIFOScheduler，避免 dequeue 情境預先塞滿時阻塞
+    int start(int workers, size_t capacity)
+    {
+        if constexpr (std::is_same_v<SchedulerT, LockFreeFIFOScheduler>)
+            pool_.setScheduler(std::make_unique<SchedulerT>(capacity));
+        else
+            pool_.setScheduler(std::make_unique<SchedulerT>());
+        pool_.start(workers);
+        return workers;
+    }
+
+    template<typename F>
+    void post(F&& f)
+    {
+        if constexpr (std::is_same_v<SchedulerT, DAGScheduler>)
+            pool_.submitDAG(std::make_shared<TaskNode>(Task(std::forward<F>(f))), {});
+        else
+            pool_.submit(Task(std::forward<F>(f)), TaskPriority::MEDIUM);
+    }
+
+    void stop() {  pool_.stop();  }
+
+private:
+    BasicThreadPool<SchedulerT> pool_;
+};
+
+#ifdef CE_BUILD_LEGACY_POOL
+// 舊版 pool 的 FIXED 模式最多只建立 4 條執行緒，回傳實際數量
+// 其工作執行緒會以 std::cout 印除錯訊息，執行期間把 std::cout 導向不保存內容的 buffer
+class LegacyPool
+{
+public:
+    int start(int workers, size_t /*capacity*/)
+    {
+        saved_ = std::cout.rdbuf(&sink_);
+        pool_ = std::make_unique<Legacy::ThreadPool>();
+        pool_->setMode(PoolMode::MODE_FIXED);
+        pool_->setMaxThreadCount(static_cast<size_t>(workers));
+        pool_->setTaskQueueMaxSize(1 << 30);
+        pool_->start();
+        return std::min(workers, 4);
+    }
+
+    template<typename F>
+    void post(F&& f) {  pool_->submit(std::function<void()>(std::forward<F>(f)));  }
+
+    void stop()
+    {
+        pool_->stop();
+        pool_.reset();
+        std::cout.rdbuf(saved_);
+    }
+
+private:
+    // 無緩衝區、無狀態，多執行緒同時寫入也安全
+    struct NullBuffer : std::streambuf
+    {
+        int overflow(int c) override {  return c;  }
+    };
+
+    NullBuffer sink_;
+    std::streambuf* saved_ = nullptr;
+    std::unique_ptr<Legacy::ThreadPool> pool_;
+};
+#endif
+
+// ---- Scenarios ----
+
+// producers 條執行緒同時提交共 tasks 個空任務；計時到全部提交完成（consumers = 工作執行緒數）
+template<typename Pool>
+Result submitThroughput(const std::string& name, int producers, int workers, size_t tasks)
+{
+    Pool pool;
+    int consumers = pool.start(workers, tasks);
+
+    std::atomic<size_t> done{0};
+    std::atomic<bool> go{false};
+    std::vector<std::thread> threads;
+    const size_t perProducer = tasks / static_cast<size_t>(producers);
+
+    for (int p = 0; p < producers; ++p)
+    {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire))
+                std::this_thread::yield();
+            for (size_t i = 0; i < perProducer; ++i)
+                pool.post([&done] { done.fetch_add(1, std::memory_order_release); });
+        });
+    }
+
+    auto t0 = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads)
+        t.join();
+    auto t1 = Clock::now();
+
+    const size_t total = perProducer * static_cast<size_t>(producers);
+    waitFor(done, total);
+    pool.stop();
+
+    Result r{name, "submit_throughput", producers, consumers, total};
+    r.seconds = std::chrono::duration<double>(t1 - t0).count();
+    r.opsPerSec = static_cast<double>(total) / r.seconds;
+    return r;
+}
+
+// 先以 gate 任務佔住所有工作執行緒、讓佇列累積 tasks 個空任務，再放行並計時到全部執行完
+template<typename Pool>
+Result dequeueThroughput(const std::string& name, int workers, size_t tasks)
+{
+    Pool pool;
+    int consumers = pool.start(workers, tasks + static_cast<size_t>(workers));
+
+    std::atomic<bool> release{false};
+    std::atomic<size_t> gated{0};
+    std::atomic<size_t> done{0};
+
+    for (int i = 0; i < consumers; ++i)
+    {
+        pool.post([&] {
+            gated.fetch_add(1, std::memory_order_release);
+            while (!release.load(std::memory_order_acquire))
+                std::this_thread::yield();
+        });
+    }
+    waitFor(gated, static_cast<size_t>(consumers));
+
+    for (size_t i = 0; i < tasks; ++i)
+        pool.post([&done] { done.fetch_add(1, std::memory_order_release); });
+
+    auto t0 = Clock::now();
+    release.store(true, std::memory_order_release);
+    waitFor(done, tasks);
+    auto t1 = Clock::now();
+    pool.stop();
+
+    Result r{name, "dequeue_throughput", 1, consumers, tasks};
+    r.seconds = std::chrono::duration<double>(t1 - t0).count();
+    r.opsPerSec = static_cast<double>(tasks) / r.seconds;
+    return r;
+}
+
+// 單一 producer 提交空任務並等待它執行完，重複 samples 次
+template<typename Pool>
+Result roundTripLatency(const std::string& name, int workers, size_t samples)
+{
+    Pool pool;
+    int consumers = pool.start(workers, 0);
+
+    std::vector<double> latencies;
+    latencies.reserve(samples);
+    std::atomic<size_t> done{0};
+
+    auto t0 = Clock::now();
+    for (size_t i = 0; i < samples; ++i)
+    {
+        auto start = Clock::now();
+        pool.post([&done] { done.fetch_add(1, std::memory_order_release); });
+        waitFor(done, i + 1);
+        latencies.push_back(std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+    }
+    auto t1 = Clock::now();
+    pool.stop();
+
+    Result r{name, "round_trip_latency", 1, consumers, samples};
+    r.seconds = std::chrono::duration<double>(t1 - t0).count();
+    r.opsPerSec = static_cast<double>(samples) / r.seconds;
+    r.meanNs = r.seconds * 1e9 / static_cast<double>(samples);
+    r.p50Ns = percentile(latencies, 0.50);
+    r.p99Ns = percentile(latencies, 0.99);
+    return r;
+}
+
+std::vector<int> threadSweep(int maxThreads)
+{
+    std::vector<int> counts;
+    for (int n = 1; n < maxThreads; n *= 2)
+        counts.push_back(n);
+    counts.push_back(maxThreads);
+    return counts;
+}
+
+template<typename Pool>
+void runAll(const std::string& name, const Options& opt, std::vector<Result>& results)
+{
+    std::fprintf(stderr, "[ce_bench] %s\n", name.c_str());
+
+    for (int n : threadSweep(opt.maxThreads))
+        results.push_back(submitThroughput<Pool>(name, n, opt.maxThreads, opt.tasks));
+
+    for (int n : threadSweep(opt.maxThreads))
+        results.push_back(dequeueThroughput<Pool>(name, n, opt.tasks));
+
+    for (int n : threadSweep(opt.maxThreads))
+        results.push_back(roundTripLatency<Pool>(name, n, opt.samples));
+}
+
+// ---- Output ----
+
+void writeCsv(std::ostream& out, const std::vector<Result>& results)
+{
+    out << "scheduler,scenario,producers,consumers,tasks,seconds,ops_per_sec,mean_ns,p50_ns,p99_ns\n";
+    for (const auto& r : results)
+    {
+        out << r.scheduler << ',' << r.scenario << ',' << r.producers << ',' << r.consumers << ','
+            << r.tasks << ',' << r.seconds << ',' << r.opsPerSec << ','
+            << r.meanNs << ',' << r.p50Ns << ',' << r.p99Ns << '\n';
+    }
+}
+
+void writeJson(std::ostream& out, const std::vector<Result>& results, const Options& opt)
+{
+    out << "{\n  \"hardware_concurrency\": " << std::thread::hardware_concurrency()
+        << ",\n  \"max_threads\": " << opt.maxThreads
+        << ",\n  \"results\": [\n";
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const auto& r = results[i];
+        out << "    {\"scheduler\": \"" << r.scheduler << "\", \"scenario\": \"" << r.scenario
+            << "\", \"producers\": " << r.producers << ", \"consumers\": " << r.consumers
+            << ", \"tasks\": " << r.tasks << ", \"seconds\": " << r.seconds
+            << ", \"ops_per_sec\": " << r.opsPerSec << ", \"mean_ns\": " << r.meanNs
+            << ", \"p50_ns\": " << r.p50Ns << ", \"p99_ns\": " << r.p99Ns << "}"
+            << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+}
+
+std::vector<std::string> splitList(const std::string& text)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+bool parseArgs(int argc, char** argv, Options& opt)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto value = [&](const char* key) -> const char* {
+            size_t len = std::char_traits<char>::length(key);
+            return arg.compare(0, len, key) == 0 ? arg.c_str() + len : nullptr;
+        };
+
+        if (auto v = value("--format="))           opt.format = v;
+        else if (auto v = value("--out="))         opt.out = v;
+        else if (auto v = value("--tasks="))       opt.tasks = std::strtoull(v, nullptr, 10);
+        else if (auto v = value("--samples="))     opt.samples = std::strtoull(v, nullptr, 10);
+        else if (auto v = value("--max-threads=")) opt.maxThreads = std::max(1, std::atoi(v));
+        else if (auto v = value("--schedulers="))  opt.schedulers = splitList(v);
+        else if (arg == "--quick")
+        {
+            opt.tasks = 20000;
+            opt.samples = 2000;
+        }
+        else
+        {
+            std::fprintf(stderr, "[ce_bench] Unknown option: %s\n", arg.c_str());
+            return false;
+        }
+    }
+
+    if (opt.format != "json" && opt.format != "csv")
+    {
+        std::fprintf(stderr, "[ce_bench] --format must be json or csv\n");
+        return false;
+    }
+    opt.tasks = std::max<size_t>(opt.tasks, 1);
+    opt.samples = std::max<size_t>(opt.samples, 1);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+        return 2;
+
+    ThreadLogger::getInstance().setLevel(LogLevel::ERROR);
+
+    std::vector<Result> results;
+    for (const auto& name : opt.schedulers)
+    {
+        if (name == "fifo")
+            runAll<EnginePool<FIFOScheduler>>(name, opt, results);
+        else if (name == "priority")
+            runAll<EnginePool<PriorityScheduler>>(name, opt, results);
+        else if (name == "dag")
+            runAll<EnginePool<DAGScheduler>>(name, opt, results);
+        else if (name == "lockfree")
+            runAll<EnginePool<LockFreeFIFOScheduler>>(name, opt, results);
+        else if (name == "workstealing")
+            runAll<EnginePool<WorkStealingScheduler>>(name, opt, results);
+#ifdef CE_BUILD_LEGACY_POOL
+        else if (name == "legacy")
+            runAll<LegacyPool>(name, opt, results);
+#endif
+        else
+            std::fprintf(stderr, "[ce_bench] Skipping unknown or disabled scheduler: %s\n", name.c_str());
+    }
+
+    if (opt.out.empty())
+    {
+        opt.format == "csv" ? writeCsv(std::cout, results) : writeJson(std::cout, results, opt);
+    }
+    else
+    {
+        std::ofstream file(opt.out);
+        if (!file)
+        {
+            std::fprintf(stderr, "[ce_bench] Cannot open %s\n", opt.out.c_str());
+            return 1;
+        }
+        opt.format == "csv" ? writeCsv(file, results) : writeJson(file, results, opt);
+    }
+    return 0;
+}
@@ -0,0 +1,619 @@
+// ce_loadgen.cpp
+// 開放迴路（open-loop）負載產生器：依排定的到達時間提交任務，不因 pool 變慢而延後下一個到達，
+// 延遲一律從「預定到達時間」起算，避免 closed-loop 測試的 coordinated omission
+//
+// 對每個負載比例 × RejectPolicy 執行一輪，依 TaskPriority 分別回報 queueing delay 與 end-to-end latency
+// 的 p50 / p99 / p99.9 / max，以及被拒絕（THROW）與被丟棄（DISCARD / DROP_OLDEST / EDF 逾期）的任務數
+// CALLER_RUNS 由提交執行緒自己執行，會拖慢之後的到達，延遲仍從預定到達時間起算
+//
+//   ce_loadgen [--scheduler=priority|fifo|edf] [--budget=10ms] [--threads=N] [--queue=N] [--duration=2s]
+//              [--loads=0.9,1.0,1.2] [--policies=block,discard,throw,caller_runs,drop_oldest]
+//              [--service=exp:200us | fixed:100us | bimodal:100us:2ms:0.05 | lognormal:200us:1.0]
+//              [--priority-mix=0.2,0.5,0.3] [--arrivals=poisson | trace:FILE] [--aging=5ms[:32]]
+//              [--wait=blocking|balanced|latency|spin:N:Y] [--format=text|csv|json] [--out=FILE] [--seed=N]
+//
+// edf：每個任務的期限為預定到達時間 + budget，開始前已逾期的任務不執行（計入 dropped）
+// wait：工作執行緒閒置時的 WaitStrategy，spin:N:Y 為自旋 N 次、yield Y 次後休眠；低負載時主要影響 queue 延遲
+// trace 檔每行為「到達時間(us) 執行時間(us) [priority 0=HIGH 1=MEDIUM 2=LOW]」，到達時間會除以負載比例
+#include <threadPool/threadPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+int64_t nowNs()
+{  return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();  }
+
+// 解析 "200us"、"2ms"、"1.5s"、"500ns"，回傳奈秒
+bool parseDuration(const std::string& text, double& ns)
+{
+    size_t pos = 0;
+    double value = 0;
+    try {  value = std::stod(text, &pos);  }
+    catch (const std::exception&) {  return false;  }
+
+    std::string unit = text.substr(pos);
+    if (unit == "ns")                    ns = value;
+    else if (unit == "us")               ns = value * 1e3;
+    else if (unit == "ms")               ns = value * 1e6;
+    else if (unit == "s" || unit.empty()) ns = value * 1e9;
+    else return false;
+    return true;
+}
+
+std::vector<std::string> split(const std::string& text, char sep)
+{
+    std::vector<std::string> items;
+    std::stringstream ss(text);
+    std::string item;
+    while (std::getline(ss, item, sep))
+        items.push_back(item);
+    return items;
+}
+
+// ---- 任務執行時間分佈 ----
+
+struct ServiceDist
+{
+    enum class Kind { FIXED, EXP, BIMODAL, LOGNORMAL };
+
+    Kind kind = Kind::EXP;
+    double a = 200e3;    // FIXED/EXP/LOGNORMAL：平均值；BIMODAL：短任務
+    double b = 0;        // BIMODAL：長任務
+    double p = 0;        // BIMODAL：長任務比例；LOGNORMAL：sigma
+
+    double mean() const
+    {
+        return kind == Kind::BIMODAL ? (1 - p) * a + p * b : a;
+    }
+
+    double sample(std::mt19937_64& rng) const
+    {
+        switch (kind)
+        {
+            case Kind::FIXED:
+                return a;
+            case Kind::EXP:
+                return std::exponential_distribution<double>(1.0 / a)(rng);
+            case Kind::BIMODAL:
+                return std::bernoulli_distribution(p)(rng) ? b : a;
+            case Kind::LOGNORMAL:
+                // 以平均值 a、sigma p 反推 mu
+                return std::lognormal_distribution<double>(std::log(a) - p * p / 2, p)(rng);
+        }
+        return a;
+    }
+
+    static bool parse(const std::string& text, ServiceDist& out)
+    {
+        auto parts = split(text, ':');
+        if (parts.size() < 2) return false;
+
+        if (parts[0] == "fixed" && parts.size() == 2)
+        {
+            out.kind = Kind::FIXED;
+            return parseDuration(parts[1], out.a);
+        }
+        if (parts[0] == "exp" && parts.size() == 2)
+        {
+            out.kind = Kind::EXP;
+            return parseDuration(parts[1], out.a);
+        }
+        if (parts[0] == "bimodal" && parts.size() == 4)
+        {
+            out.kind = Kind::BIMODAL;
+            out.p = std::atof(parts[3].c_str());
+            return parseDuration(parts[1], out.a) && parseDuration(parts[2], out.b) && out.p >= 0 && out.p <= 1;
+        }
+        if (parts[0] == "lognormal" && parts.size() == 3)
+        {
+            out.kind = Kind::LOGNORMAL;
+            out.p = std::atof(parts[2].c_str());
+            return parseDuration(parts[1], out.a) && out.p > 0;
+        }
+        return false;
+    }
+};
+
+// ---- 設定 ----
+
+struct Options
+{
+    std::string scheduler = "priority";
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    size_t queue = 1024;
+    double durationNs = 2e9;
+    std::vector<double> loads = {0.9, 1.0, 1.2};
+    std::vector<RejectPolicy> policies = {RejectPolicy::BLOCK, RejectPolicy::DISCARD, RejectPolicy::THROW};
+    ServiceDist service;
+    double priorityMix[3] = {0.2, 0.5, 0.3};   // HIGH / MEDIUM / LOW
+    std::string traceFile;
+    double agingNs = 0;        // PriorityScheduler aging 門檻，0 為關閉
+    unsigned agingStep = 32;
+    double budgetNs = 10e6;    // edf 的回應期限
+    WaitStrategy wait = WaitStrategy::balanced();
+    std::string format = "text";
+    std::string out;
+    uint64_t seed = 42;
+};
+
+// 一個預定的到達：時間相對於該輪開始（奈秒）
+struct Arrival
+{
+    double offsetNs;
+    double serviceNs;
+    TaskPriority priority;
+};
+
+// 每個任務一筆紀錄：提交執行緒寫 intended / rejected，工作執行緒寫 start / end
+struct Record
+{
+    int64_t intended = 0;
+    int64_t start = 0;
+    int64_t end = 0;
+    TaskPriority priority = TaskPriority::MEDIUM;
+    bool rejected = false;
+};
+
+const char* policyName(RejectPolicy policy)
+{
+    switch (policy)
+    {
+        case RejectPolicy::BLOCK:       return "BLOCK";
+        case RejectPolicy::DISCARD:     return "DISCARD";
+        case RejectPolicy::THROW:       return "THROW";
+        case RejectPolicy::CALLER_RUNS: return "CALLER_RUNS";
+        case RejectPolicy::DROP_OLDEST: return "DROP_OLDEST";
+    }
+    return "?";
+}
+
+const char* priorityName(TaskPriority priority)
+{
+    switch (priority)
+    {
+        case TaskPriority::HIGH:   return "HIGH";
+        case TaskPriority::MEDIUM: return "MEDIUM";
+        case TaskPriority::LOW:    return "LOW";
+    }
+    return "?";
+}
+
+TaskPriority priorityFromIndex(int i)
+{
+    return i == 0 ? TaskPriority::HIGH : i == 1 ? TaskPriority::MEDIUM : TaskPriority::LOW;
+}
+
+// ---- 到達序列 ----
+
+std::vector<Arrival> poissonArrivals(const Options& opt, double load, std::mt19937_64& rng)
+{
+    // 容量 = threads / 平均執行時間；到達率 = load × 容量
+    const double rate = load * opt.threads / opt.service.mean();   // 每奈秒
+    std::exponential_distribution<double> gap(rate);
+    std::discrete_distribution<int> prio(std::begin(opt.priorityMix), std::end(opt.priorityMix));
+
+    std::vector<Arrival> arrivals;
+    arrivals.reserve(static_cast<size_t>(rate * opt.durationNs * 1.1) + 16);
+
+    double t = 0;
+    while ((t += gap(rng)) < opt.durationNs)
+    {
+        TaskPriority p = opt.scheduler == "priority" ? priorityFromIndex(prio(rng)) : TaskPriority::MEDIUM;
+        arrivals.push_back({t, opt.service.sample(rng), p});
+    }
+    return arrivals;
+}
+
+bool traceArrivals(const Options& opt, double load, std::vector<Arrival>& arrivals)
+{
+    std::ifstream in(opt.traceFile);
+    if (!in)
+    {
+        std::fprintf(stderr, "[ce_loadgen] Cannot open trace %s\n", opt.traceFile.c_str());
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(in, line))
+    {
+        if (line.empty() || line[0] == '#') continue;
+
+        std::istringstream ls(line);
+        double arrivalUs = 0, serviceUs = 0;
+        int prio = 1;
+        if (!(ls >> arrivalUs >> serviceUs)) continue;
+        ls >> prio;
+
+        TaskPriority p = opt.scheduler == "priority" ? priorityFromIndex(std::clamp(prio, 0, 2)) : TaskPriority::MEDIUM;
+        arrivals.push_back({arrivalUs * 1e3 / load, serviceUs * 1e3, p});
+    }
+
+    std::sort(arrivals.begin(), arrivals.end(),
+              [](const Arrival& x, const Arrival& y) { return x.offsetNs < y.offsetNs; });
+    return true;
+}
+
+// ---- 執行一輪 ----
+
+void spinFor(int64_t ns)
+{
+    const int64_t until = nowNs() + ns;
+    while (nowNs() < until)
+    {}
+}
+
+void waitUntil(int64_t target)
+{
+    // 距離超過 200us 時先睡，剩下的以 yield 逼近，避免 sleep 精度拉高到達時間的誤差
+    int64_t remaining = target - nowNs();
+    if (remaining > 200'000)
+        std::this_thread::sleep_for(std::chrono::nanoseconds(remaining - 100'000));
+    while (nowNs() < target)
+        std::this_thread::yield();
+}
+
+std::unique_ptr<IScheduler> makeScheduler(const Options& opt, RejectPolicy policy)
+{
+    std::unique_ptr<IScheduler> scheduler;
+    if (opt.scheduler == "fifo")
+        scheduler = std::make_unique<FIFOScheduler>();
+    else if (opt.scheduler == "edf")
+        scheduler = std::make_unique<EDFScheduler>();
+    else
+    {
+        auto priority = std::make_unique<PriorityScheduler>();
+        if (opt.agingNs > 0)
+            priority->setAging(std::chrono::nanoseconds(static_cast<int64_t>(opt.agingNs)), opt.agingStep);
+        scheduler = std::move(priority);
+    }
+
+    scheduler->setRejectPolicy(policy);
+    scheduler->setMaxQueueSize(opt.queue);
+    return scheduler;
+}
+
+std::vector<Record> runOnce(const Options& opt, const std::vector<Arrival>& arrivals, RejectPolicy policy)
+{
+    std::vector<Record> records(arrivals.size());
+
+    ThreadPool pool(makeScheduler(opt, policy));
+    pool.setWaitStrategy(opt.wait);
+    pool.start(opt.threads);
+
+    const int64_t base = nowNs() + 1'000'000;   // 預留 1ms 讓工作執行緒就緒
+
+    for (size_t i = 0; i < arrivals.size(); ++i)
+    {
+        Record& rec = records[i];
+        rec.intended = base + static_cast<int64_t>(arrivals[i].offsetNs);
+        rec.priority = arrivals[i].priority;
+
+        // 落後排程時立即提交，但延遲仍從 intended 起算
+        waitUntil(rec.intended);
+
+        const int64_t service = static_cast<int64_t>(arrivals[i].serviceNs);
+        Task task([&rec, service] {
+            rec.start = nowNs();
+            spinFor(service);
+            rec.end = nowNs();
+        });
+
+        try
+        {
+            if (opt.scheduler == "edf")
+                pool.submitWithDeadline(std::move(task), Deadline(std::chrono::nanoseconds(rec.intended + static_cast<int64_t>(opt.budgetNs))));
+            else
+                pool.submit(std::move(task), rec.priority);
+        }
+        catch (const std::exception&)
+        {  rec.rejected = true;  }
+    }
+
+    // 等佇列清空且所有工作執行緒閒置（連續兩次確認，避免剛取出任務尚未標記忙碌的空窗）
+    // DISCARD / DROP_OLDEST 丟掉的任務不會有 start
+    auto drained = [&] { return pool.getQueueSize() == 0 && pool.getFreeThreadCount() >= pool.getCurThreadCount(); };
+    while (!drained() || (std::this_thread::sleep_for(std::chrono::milliseconds(1)), !drained()))
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    pool.stop();
+    return records;
+}
+
+// ---- 統計 ----
+
+struct Summary
+{
+    double load = 0;
+    std::string policy;
+    std::string priority;
+    size_t submitted = 0;
+    size_t completed = 0;
+    size_t rejected = 0;
+    size_t dropped = 0;
+    double queue[4] = {};   // p50, p99, p99.9, max（微秒）
+    double e2e[4] = {};
+};
+
+void fillPercentiles(std::vector<double>& values, double out[4])
+{
+    if (values.empty()) return;
+    std::sort(values.begin(), values.end());
+    auto at = [&](double p) {
+        return values[std::min(values.size() - 1, static_cast<size_t>(p * static_cast<double>(values.size())))];
+    };
+    out[0] = at(0.50);
+    out[1] = at(0.99);
+    out[2] = at(0.999);
+    out[3] = values.back();
+}
+
+std::vector<Summary> summarize(double load, RejectPolicy policy, const std::vector<Record>& records, bool perPriority)
+{
+    std::vector<Summary> rows;
+
+    auto build = [&](const char* label, auto match) {
+        Summary s;
+        s.load = load;
+        s.policy = policyName(policy);
+        s.priority = label;
+
+        std::vector<double> queue, e2e;
+        for (const auto& r : records)
+        {
+            if (!match(r)) continue;
+            ++s.submitted;
+            if (r.rejected)      ++s.rejected;
+            else if (!r.start)   ++s.dropped;
+            else
+            {
+                ++s.completed;
+                queue.push_back(static_cast<double>(r.start - r.intended) / 1e3);
+                e2e.push_back(static_cast<double>(r.end - r.intended) / 1e3);
+            }
+        }
+        fillPercentiles(queue, s.queue);
+        fillPercentiles(e2e, s.e2e);
+        rows.push_back(s);
+    };
+
+    if (perPriority)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            TaskPriority p = priorityFromIndex(i);
+            build(priorityName(p), [p](const Record& r) { return r.priority == p; });
+        }
+    }
+    build("ALL", [](const Record&) { return true; });
+    return rows;
+}
+
+// ---- 輸出 ----
+
+void writeText(std::ostream& out, const std::vector<Summary>& rows)
+{
+    char line[256];
+    double lastLoad = -1;
+    std::string lastPolicy;
+
+    for (const auto& s : rows)
+    {
+        if (s.load != lastLoad || s.policy != lastPolicy)
+        {
+            std::snprintf(line, sizeof(line), "\n== load %.0f%%  policy %s ==\n", s.load * 100, s.policy.c_str());
+            out << line;
+            out << "priority   submitted  completed  rejected   dropped |"
+                   "   queue p50     p99   p99.9     max |     e2e p50     p99   p99.9     max  (us)\n";
+            lastLoad = s.load;
+            lastPolicy = s.policy;
+        }
+
+        std::snprintf(line, sizeof(line),
+                      "%-8s %11zu %10zu %9zu %9zu | %11.1f %7.1f %7.1f %7.1f | %11.1f %7.1f %7.1f %7.1f\n",
+                      s.priority.c_str(), s.submitted, s.completed, s.rejected, s.dropped,
+                      s.queue[0], s.queue[1], s.queue[2], s.queue[3],
+                      s.e2e[0], s.e2e[1], s.e2e[2], s.e2e[3]);
+        out << line;
+    }
+}
+
+void writeCsv(std::ostream& out, const std::vector<Summary>& rows)
+{
+    out << "load,policy,priority,submitted,completed,rejected,dropped,"
+           "queue_p50_us,queue_p99_us,queue_p999_us,queue_max_us,"
+           "e2e_p50_us,e2e_p99_us,e2e_p999_us,e2e_max_us\n";
+    for (const auto& s : rows)
+    {
+        out << s.load << ',' << s.policy << ',' << s.priority << ',' << s.submitted << ',' << s.completed << ','
+            << s.rejected << ',' << s.dropped;
+        for (double v : s.queue) out << ',' << v;
+        for (double v : s.e2e) out << ',' << v;
+        out << '\n';
+    }
+}
+
+void writeJson(std::ostream& out, const std::vector<Summary>& rows)
+{
+    out << "[\n";
+    for (size_t i = 0; i < rows.size(); ++i)
+    {
+        const auto& s = rows[i];
+        out << "  {\"load\": " << s.load << ", \"policy\": \"" << s.policy << "\", \"priority\": \"" << s.priority
+            << "\", \"submitted\": " << s.submitted << ", \"completed\": " << s.completed
+            << ", \"rejected\": " << s.rejected << ", \"dropped\": " << s.dropped
+            << ", \"queue_us\": {\"p50\": " << s.queue[0] << ", \"p99\": " << s.queue[1]
+            << ", \"p999\": " << s.queue[2] << ", \"max\": " << s.queue[3] << "}"
+            << ", \"e2e_us\": {\"p50\": " << s.e2e[0] << ", \"p99\": " << s.e2e[1]
+            << ", \"p999\": " << s.e2e[2] << ", \"max\": " << s.e2e[3] << "}}"
+            << (i + 1 < rows.size() ? ",\n" : "\n");
+    }
+    out << "]\n";
+}
+
+bool parseArgs(int argc, char** argv, Options& opt)
+{
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        auto value = [&](const char* key) -> const char* {
+            size_t len = std::char_traits<char>::length(key);
+            return arg.compare(0, len, key) == 0 ? arg.c_str() + len : nullptr;
+        };
+
+        if (auto v = value("--scheduler="))     opt.scheduler = v;
+        else if (auto v = value("--threads="))  opt.threads = std::max(1, std::atoi(v));
+        else if (auto v = value("--queue="))    opt.queue = std::strtoull(v, nullptr, 10);
+        else if (auto v = value("--seed="))     opt.seed = std::strtoull(v, nullptr, 10);
+        else if (auto v = value("--format="))   opt.format = v;
+        else if (auto v = value("--out="))      opt.out = v;
+        else if (auto v = value("--duration="))
+        {
+            if (!parseDuration(v, opt.durationNs)) return false;
+        }
+        else if (auto v = value("--loads="))
+        {
+            opt.loads.clear();
+            for (const auto& item : split(v, ','))
+                opt.loads.push_back(std::atof(item.c_str()));
+        }
+        else if (auto v = value("--policies="))
+        {
+            opt.policies.clear();
+            for (const auto& item : split(v, ','))
+            {
+                if (item == "block")            opt.policies.push_back(RejectPolicy::BLOCK);
+                else if (item == "discard")     opt.policies.push_back(RejectPolicy::DISCARD);
+                else if (item == "throw")       opt.policies.push_back(RejectPolicy::THROW);
+                else if (item == "caller_runs") opt.policies.push_back(RejectPolicy::CALLER_RUNS);
+                else if (item == "drop_oldest") opt.policies.push_back(RejectPolicy::DROP_OLDEST);
+                else return false;
+            }
+        }
+        else if (auto v = value("--service="))
+        {
+            if (!ServiceDist::parse(v, opt.service)) return false;
+        }
+        else if (auto v = value("--priority-mix="))
+        {
+            auto parts = split(v, ',');
+            if (parts.size() != 3) return false;
+            for (int k = 0; k < 3; ++k)
+                opt.priorityMix[k] = std::atof(parts[static_cast<size_t>(k)].c_str());
+        }
+        else if (auto v = value("--budget="))
+        {
+            if (!parseDuration(v, opt.budgetNs)) return false;
+        }
+        else if (auto v = value("--aging="))
+        {
+            auto parts = split(v, ':');
+            if (parts.empty() || parts.size() > 2 || !parseDuration(parts[0], opt.agingNs)) return false;
+            if (parts.size() == 2)
+                opt.agingStep = static_cast<unsigned>(std::max(1, std::atoi(parts[1].c_str())));
+        }
+        else if (auto v = value("--wait="))
+        {
+            std::string mode = v;
+            if (mode == "blocking")      opt.wait = WaitStrategy::blocking();
+            else if (mode == "balanced") opt.wait = WaitStrategy::balanced();
+            else if (mode == "latency")  opt.wait = WaitStrategy::lowLatency();
+            else
+            {
+                auto parts = split(v, ':');
+                if (parts.size() != 3 || parts[0] != "spin") return false;
+                opt.wait.spins = static_cast<uint32_t>(std::strtoul(parts[1].c_str(), nullptr, 10));
+                opt.wait.yields = static_cast<uint32_t>(std::strtoul(parts[2].c_str(), nullptr, 10));
+            }
+        }
+        else if (auto v = value("--arrivals="))
+        {
+            std::string mode = v;
+            if (mode.rfind("trace:", 0) == 0)
+                opt.traceFile = mode.substr(6);
+            else if (mode != "poisson")
+                return false;
+        }
+        else
+            return false;
+    }
+
+    return (opt.scheduler == "priority" || opt.scheduler == "fifo" || opt.scheduler == "edf") &&
+           (opt.format == "text" || opt.format == "csv" || opt.format == "json") &&
+           !opt.loads.empty() && opt.service.mean() > 0;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    if (!parseArgs(argc, argv, opt))
+    {
+        std::fprintf(stderr, "[ce_loadgen] Invalid arguments, see the header of bench/ce_loadgen.cpp\n");
+        return 2;
+    }
+
+    ThreadLogger::getInstance().setLevel(LogLevel::ERROR);
+
+    std::vector<Summary> rows;
+    for (double load : opt.loads)
+    {
+        // 同一負載下各 RejectPolicy 使用相同的到達序列，結果才能直接比較
+        std::mt19937_64 rng(opt.seed);
+        std::vector<Arrival> arrivals;
+        if (opt.traceFile.empty())
+            arrivals = poissonArrivals(opt, load, rng);
+        else if (!traceArrivals(opt, load, arrivals))
+            return 1;
+
+        for (RejectPolicy policy : opt.policies)
+        {
+            std::fprintf(stderr, "[ce_loadgen] load %.0f%% policy %s: %zu arrivals\n",
+                         load * 100, policyName(policy), arrivals.size());
+
+            auto records = runOnce(opt, arrivals, policy);
+            auto summary = summarize(load, policy, records, opt.scheduler == "priority");
+            rows.insert(rows.end(), summary.begin(), summary.end());
+        }
+    }
+
+    std::ofstream file;
+    if (!opt.out.empty())
+    {
+        file.open(opt.out);
+        if (!file)
+        {
+            std::fprintf(stderr, "[ce_loadgen] Cannot open %s\n", opt.out.c_str());
+            return 1;
+        }
+    }
+    std::ostream& out = opt.out.empty() ? std::cout : file;
+
+    if (opt.format == "csv")
+        writeCsv(out, rows);
+    else if (opt.format == "json")
+        writeJson(out, rows);
+    else
+        writeText(out, rows);
+
+    return 0;
+}
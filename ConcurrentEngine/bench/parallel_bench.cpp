@@ -0,0 +1,105 @@
+// parallel_bench.cpp
+// 比較 serial 迴圈、逐元素 submit + future、parallel_for / parallel_reduce / parallel_transform
+#include <threadPool/threadPool.hpp>
+#include <threadPool/algorithm/parallel.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+namespace
+{
+
+template<typename F>
+double timeMs(F&& f, int repeat = 5)
+{
+    double best = 1e300;
+    for (int r = 0; r < repeat; ++r)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        f();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+inline double work(double x)
+{  return std::sqrt(x) * std::sin(x) + std::cos(x * 0.5);  }
+
+void report(const char* name, double ms, double serialMs)
+{  std::printf("%-28s %10.3f ms   speedup %6.2fx\n", name, ms, serialMs / ms);  }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4'000'000;
+    const int threads = argc > 2 ? std::atoi(argv[2])
+                                 : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+
+    ThreadLogger::getInstance().setLevel(LogLevel::WARN);
+
+    ThreadPool pool(std::make_unique<FIFOScheduler>());
+    pool.start(threads);
+
+    std::vector<double> in(n), out(n);
+    std::iota(in.begin(), in.end(), 0.0);
+
+    std::printf("n = %zu, threads = %d\n", n, threads);
+
+    // for_each
+    double serial = timeMs([&] {
+        for (size_t i = 0; i < n; ++i)
+            out[i] = work(in[i]);
+    });
+    report("serial for", serial, serial);
+
+    // 舊做法：每個元素一個 future（只量測 n / 100 個元素後換算）
+    const size_t sample = std::max<size_t>(1, n / 100);
+    double perElement = timeMs([&] {
+        std::vector<std::future<void>> futs;
+        futs.reserve(sample);
+        for (size_t i = 0; i < sample; ++i)
+            futs.push_back(pool.submit([&, i] { out[i] = work(in[i]); }));
+        for (auto& f : futs)
+            f.get();
+    }, 1) * static_cast<double>(n) / static_cast<double>(sample);
+    report("submit per element (est.)", perElement, serial);
+
+    double pfor = timeMs([&] {
+        parallel_for(pool, size_t{0}, n, [&](size_t i) { out[i] = work(in[i]); });
+    });
+    report("parallel_for", pfor, serial);
+
+    double ptrans = timeMs([&] {
+        parallel_transform(pool, in.begin(), in.end(), out.begin(), work);
+    });
+    report("parallel_transform", ptrans, serial);
+
+    // reduce
+    double sink = 0;
+    double serialReduce = timeMs([&] {
+        double acc = 0;
+        for (size_t i = 0; i < n; ++i)
+            acc += work(in[i]);
+        sink += acc;
+    });
+    report("serial reduce", serialReduce, serialReduce);
+
+    double preduce = timeMs([&] {
+        sink += parallel_reduce(pool, in.begin(), in.end(), 0.0,
+                                [](double a, double b) { return a + b; }, work);
+    });
+    report("parallel_reduce", preduce, serialReduce);
+
+    pool.stop();
+    std::printf("(checksum %.3f)\n", sink);
+    return 0;
+}
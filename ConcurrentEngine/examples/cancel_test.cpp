@@ -0,0 +1,132 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <vector>
+#include <threadPool/threadPool.hpp>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::WARN);
+
+    {
+        ThreadPool pool(std::make_unique<FIFOScheduler>());
+        pool.start(1);
+
+        CancellationToken client;
+
+        // 長時間執行的任務佔住唯一的工作執行緒，以 cancellationRequested() 輪詢後提早結束
+        auto stream = pool.submit(client, [] {
+            int chunks = 0;
+            while (!cancellationRequested() && chunks < 1000)
+            {
+                ++chunks;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return chunks;
+        });
+
+        // 同一個請求展開的任務在後面排隊
+        std::atomic<int> ran{0};
+        std::vector<TaskHandle<int>> fanOut;
+        for (int i = 0; i < 8; ++i)
+            fanOut.push_back(pool.submit(client, [&ran, i] { ++ran; return i; }));
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        // 用戶端斷線：同一個 token 的所有任務一起取消
+        fanOut.front().cancel();
+
+        int cancelled = 0;
+        for (auto& handle : fanOut)
+        {
+            try
+            {  handle.get();  }
+            catch (const TaskCancelled&)
+            {  ++cancelled;  }
+        }
+        try
+        {  std::cout << "stream chunks: " << stream.get() << "\n";  }
+        catch (const TaskCancelled& e)
+        {  std::cout << "stream: " << e.what() << "\n";  }
+
+        std::cout << "fan-out ran: " << ran << ", cancelled: " << cancelled << "\n";
+        pool.stop();
+    }
+
+    {
+        ThreadPool pool(std::make_unique<DAGScheduler>());
+        pool.start(2);
+
+        auto group = std::make_shared<DAGCompletion>();
+        CancellationToken token;
+
+        // fetch -> parse -> render：取消 fetch 後，parse 與 render 也不會執行
+        auto gate = std::make_shared<TaskNode>(Task([] {  std::this_thread::sleep_for(std::chrono::milliseconds(20));  }));
+        pool.submitDAG(gate, {}, group);
+        auto [fetch, fetchHandle] = pool.submitDAG(token, [] { return std::string("payload"); }, {gate}, group);
+        auto parse = std::make_shared<TaskNode>(Task([] {  std::cout << "parse\n";  }));
+        pool.submitDAG(parse, {fetch}, group);
+        auto render = pool.submitDAG([] { std::cout << "render\n"; }, {parse}, group);
+
+        fetchHandle.cancel();
+
+        try
+        {  group->wait();  }
+        catch (const TaskCancelled& e)
+        {  std::cout << "pipeline: " << e.what() << "\n";  }
+
+        try
+        {  render.get();  }
+        catch (const TaskCancelled&)
+        {  std::cout << "render skipped\n";  }
+
+        pool.stop();
+    }
+
+    {
+        ThreadPool pool(std::make_unique<DAGScheduler>());
+        pool.start(2);
+
+        auto group = std::make_shared<DAGCompletion>();
+        CancellationToken token;
+        std::atomic<bool> downloading{false};
+
+        // download 執行中被取消：任務自行提早結束，之後的 decode 不會執行
+        auto [download, downloadHandle] = pool.submitDAG(token, [&downloading] {
+            downloading = true;
+            int chunks = 0;
+            while (!cancellationRequested() && chunks < 1000)
+            {
+                ++chunks;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+            return chunks;
+        }, {}, group);
+        auto decode = pool.submitDAG([] { std::cout << "decode\n"; }, {download}, group);
+
+        while (!downloading)
+            std::this_thread::yield();
+        downloadHandle.cancel();
+
+        try
+        {  group->wait();  }
+        catch (const TaskCancelled& e)
+        {  std::cout << "download pipeline: " << e.what() << "\n";  }
+
+        bool skipped = false;
+        try
+        {  decode.get();  }
+        catch (const TaskCancelled&)
+        {  skipped = true;  }
+        std::cout << (skipped ? "decode skipped\n" : "decode ran after a cancelled download\n");
+
+        pool.stop();
+        if (!skipped)
+            return 1;
+    }
+    return 0;
+}
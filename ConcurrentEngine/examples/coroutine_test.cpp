@@ -0,0 +1,65 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <threadPool/threadPool.hpp>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+// 每一層都等待兩個子任務：以阻塞的 future.get() 寫，兩條工作執行緒很快就會全部卡住
+Coro::Task<long> treeSum(ThreadPool& pool, int depth)
+{
+    if (depth == 0) co_return 1;
+
+    auto left = pool.spawn(treeSum(pool, depth - 1));
+    auto right = pool.spawn(treeSum(pool, depth - 1));
+    co_return 1 + co_await std::move(left) + co_await std::move(right);
+}
+
+Coro::Task<std::string> handleRequest(ThreadPool& pool, int id)
+{
+    // 切到工作執行緒，以高優先級繼續
+    co_await pool.schedule(TaskPriority::HIGH);
+
+    auto profile = pool.async([id] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return "user" + std::to_string(id);
+    });
+    auto orders = pool.async([id] {  return id * 3;  });
+
+    // 等待期間工作執行緒可以執行其他任務
+    const std::string name = co_await std::move(profile);
+    const int count = co_await std::move(orders);
+    co_return name + " has " + std::to_string(count) + " orders";
+}
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::WARN);
+
+    ThreadPool pool(std::make_unique<PriorityScheduler>());
+    pool.start(2);
+
+    std::cout << "tree nodes: " << pool.spawn(treeSum(pool, 10)).get() << "\n";
+
+    std::vector<Future<std::string>> replies;
+    for (int id = 1; id <= 4; ++id)
+        replies.push_back(pool.spawn(handleRequest(pool, id)));
+    for (auto& reply : replies)
+        std::cout << reply.get() << "\n";
+
+    // 在 pool 之外等待協程
+    auto failing = [&pool]() -> Coro::Task<void> {
+        co_await pool.schedule();
+        throw std::runtime_error("handler failed");
+    };
+    try
+    {  Coro::syncWait(failing());  }
+    catch (const std::exception& e)
+    {  std::cout << "error: " << e.what() << "\n";  }
+
+    pool.stop();
+    return 0;
+}
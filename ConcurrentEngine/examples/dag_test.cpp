@@ -32,14 +32,23 @@ int main()
     auto nodeC = std::make_shared<ConcurrentEngine::Scheduler::TaskNode>(makeTask('C'));
     auto nodeA = std::make_shared<ConcurrentEngine::Scheduler::TaskNode>(makeTask('A'));
 
-    // 提交 DAG 任務，帶入依賴
-    pool.submitDAG(nodeB, {});
-    pool.submitDAG(nodeC, {});
-    pool.submitDAG(nodeA, {nodeB, nodeC});
-
-    // 等待一段時間讓任務有機會執行完畢
-    std::this_thread::sleep_for(std::chrono::seconds(3));
-    std::cout << "Finished waiting 3 seconds\n";
+    // 提交 DAG 任務，帶入依賴；三個節點屬於同一組完成通知
+    auto done = std::make_shared<ConcurrentEngine::Scheduler::DAGCompletion>();
+    auto begin = std::chrono::steady_clock::now();
+
+    pool.submitDAG(nodeB, {}, done);
+    pool.submitDAG(nodeC, {}, done);
+    pool.submitDAG(nodeA, {nodeB, nodeC}, done);
+
+    // 形成循環的依賴會被拒絕，而不是讓節點永遠等待
+    auto nodeD = std::make_shared<ConcurrentEngine::Scheduler::TaskNode>(makeTask('D'));
+    if (!pool.submitDAG(nodeD, {nodeD}))
+        std::cout << "Self-dependent node D rejected\n";
+
+    // 等待整組完成
+    done->wait();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+    std::cout << "DAG finished in " << elapsed.count() << " ms\n";
 
     // 停止 ThreadPool
     pool.stop();
@@ -6,7 +6,12 @@
 #include <threadPool/scheduler/FIFO_schedule.hpp>
 #include <iostream>
 #include <chrono>
+#include <future>
 #include <thread>
+#include <vector>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
 
 inline void runRejectTest(RejectPolicy policy) 
 {
@@ -17,20 +22,33 @@ inline void runRejectTest(RejectPolicy policy)
     ThreadPool pool(std::move(scheduler));
     pool.start(1);
 
+    const auto caller = std::this_thread::get_id();   // CALLER_RUNS 的任務在這裡執行
+    std::vector<std::pair<int, std::future<void>>> futures;
     for (int i = 0; i < 10; ++i) 
     {
         try {
-            pool.submit([i] {
-                std::cout << "[Task " << i << "] Executing...\n";
+            futures.emplace_back(i, pool.submit(TaskPriority::MEDIUM, [i, caller] {
+                std::cout << "[Task " << i << "] Executing on "
+                          << (std::this_thread::get_id() == caller ? "main" : "worker") << "...\n";
                 std::this_thread::sleep_for(std::chrono::milliseconds(200));
-            }, TaskPriority::MEDIUM);
+            }));
             std::cout << "[Main] task submit " << i << " success\n";
         } catch (const std::exception& ex) {
             std::cout << "[Main] task submit " << i << " fail: " << ex.what() << "\n";
         }
     }
 
-    std::this_thread::sleep_for(std::chrono::seconds(5));
+    // DISCARD / DROP_OLDEST 放棄的任務，future 會收到 TaskRejected，不會永遠等待
+    for (auto& [i, future] : futures)
+    {
+        try {
+            future.get();
+            std::cout << "[Main] task " << i << " completed\n";
+        } catch (const std::exception& ex) {
+            std::cout << "[Main] task " << i << " failed: " << ex.what() << "\n";
+        }
+    }
+
     pool.stop();
 }
 
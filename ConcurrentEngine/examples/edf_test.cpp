@@ -0,0 +1,51 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <threadPool/threadPool.hpp>
+#include <threadPool/scheduler/EDFScheduler.hpp>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::WARN);
+
+    auto scheduler = std::make_unique<EDFScheduler>();
+    EDFScheduler* edf = scheduler.get();
+
+    ThreadPool pool(std::move(scheduler));
+    pool.start(1);
+
+    const auto now = std::chrono::steady_clock::now();
+
+    // 佔住唯一的工作執行緒 100ms，讓之後的任務排隊
+    auto busy = pool.submitWithDeadline(now + std::chrono::seconds(1), [] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        return std::string("busy");
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // 期限越早越先執行；50ms 的期限在 busy 結束前就會過期
+    std::vector<std::pair<int, std::future<std::string>>> requests;
+    for (int budgetMs : {400, 50, 200, 300})
+    {
+        requests.emplace_back(budgetMs, pool.submitWithDeadline(now + std::chrono::milliseconds(budgetMs), [budgetMs] {
+            return "served (budget " + std::to_string(budgetMs) + "ms)";
+        }));
+    }
+
+    std::cout << busy.get() << "\n";
+    for (auto& [budgetMs, future] : requests)
+    {
+        try
+        {  std::cout << future.get() << "\n";  }
+        catch (const DeadlineExpired& e)
+        {  std::cout << "budget " << budgetMs << "ms: " << e.what() << "\n";  }
+    }
+
+    std::cout << "expired: " << edf->expiredCount() << "\n";
+    pool.stop();
+    return 0;
+}
@@ -3,6 +3,9 @@
 #include <threadPool/scheduler/FIFO_schedule.hpp>
 #include <chrono>
 
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
 int main() 
 {
     auto scheduler = std::make_unique<FIFOScheduler>();
@@ -0,0 +1,65 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <threadPool/threadPool.hpp>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::WARN);
+
+    ThreadPool pool(std::make_unique<FIFOScheduler>());
+    pool.start(4);
+
+    // 接續在結果就緒時才交給 pool，沒有任何執行緒停在 get() 上等待
+    auto greeting = pool.async([] {  return 20;  })
+                        .then([](int x) {  return x + 1;  })
+                        .then([](int x) {  return "answer: " + std::to_string(x * 2);  });
+
+    // 扇出 / 扇入：8 個分片全部完成後才彙總
+    std::vector<Future<int>> shards;
+    for (int shard = 0; shard < 8; ++shard)
+    {
+        shards.push_back(pool.async([shard] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5 * (shard % 3)));
+            return shard * shard;
+        }));
+    }
+    auto total = when_all(std::move(shards)).then([](std::vector<int> values) {
+        int sum = 0;
+        for (int v : values) sum += v;
+        return sum;
+    });
+
+    // 對沖請求：取最先成功回應的副本
+    std::vector<Future<std::string>> replicas;
+    for (int replica = 0; replica < 3; ++replica)
+    {
+        replicas.push_back(pool.async([replica] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(30 - 10 * replica));
+            return "replica " + std::to_string(replica);
+        }));
+    }
+    auto fastest = when_any(std::move(replicas));
+
+    // 例外略過後續的 then，直接傳到最後
+    auto failed = pool.async([]() -> int {  throw std::runtime_error("shard offline");  })
+                      .then([](int x) {  return x * 2;  });
+
+    // 以下只在 main 中阻塞取結果
+    std::cout << greeting.get() << "\n";
+    std::cout << "sum of squares: " << total.get() << "\n";
+    auto [index, reply] = fastest.get();
+    std::cout << "fastest: " << reply << " (index " << index << ")\n";
+    try
+    {  failed.get();  }
+    catch (const std::exception& e)
+    {  std::cout << "error: " << e.what() << "\n";  }
+
+    pool.stop();
+    return 0;
+}
@@ -4,39 +4,50 @@
 #include <threadPool/threadPool.hpp>
 #include <threadPool/scheduler/PriorityScheduler.hpp>
 
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
 void testPriorityScheduler() {
     auto scheduler = std::make_unique<PriorityScheduler>();
     scheduler->setRejectPolicy(RejectPolicy::BLOCK);
-    scheduler->setMaxQueueSize(5);
+    scheduler->setMaxQueueSize(6);
+    // 等待超過 500ms 的任務每次提升 64 級，LOW 最多三次後到達最高級
+    scheduler->setAging(std::chrono::milliseconds(500), 64);
 
     ThreadPool pool(std::move(scheduler));
     pool.start(2);
 
     // 提交不同優先級任務
-    pool.submit([] {
+    pool.submit(TaskPriority::LOW, [] {
         std::cout << "[Low Priority] Task running\n";
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    }, TaskPriority::LOW);
+    });
 
-    pool.submit([] {
+    pool.submit(TaskPriority::HIGH, [] {
         std::cout << "[High Priority] Task running\n";
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    }, TaskPriority::HIGH);
+    });
 
-    pool.submit([] {
+    pool.submit(TaskPriority::MEDIUM, [] {
         std::cout << "[Medium Priority] Task running\n";
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    }, TaskPriority::MEDIUM);
+    });
 
-    pool.submit([] {
+    pool.submit(TaskPriority::HIGH, [] {
         std::cout << "[High Priority 2] Task running\n";
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    }, TaskPriority::HIGH);
+    });
 
-    pool.submit([] {
+    pool.submit(TaskPriority::LOW, [] {
         std::cout << "[Low Priority 2] Task running\n";
         std::this_thread::sleep_for(std::chrono::milliseconds(300));
-    }, TaskPriority::LOW);
+    });
+
+    // 數值優先級：0 最高、255 最低；HIGH / MEDIUM / LOW 分別為 64 / 128 / 192
+    pool.submit(10, [] {
+        std::cout << "[Level 10] Task running\n";
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    });
 
     std::this_thread::sleep_for(std::chrono::seconds(3));
     pool.stop();
@@ -0,0 +1,8 @@
+// reject_caller_runs.cpp
+#include "demo_common.hpp"
+
+int main() 
+{
+    runRejectTest(RejectPolicy::CALLER_RUNS);
+    return 0;
+}
@@ -0,0 +1,8 @@
+// reject_drop_oldest.cpp
+#include "demo_common.hpp"
+
+int main() 
+{
+    runRejectTest(RejectPolicy::DROP_OLDEST);
+    return 0;
+}
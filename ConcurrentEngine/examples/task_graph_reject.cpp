@@ -0,0 +1,134 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <memory>
+#include <thread>
+#include <threadPool/threadPool.hpp>
+#include <threadPool/scheduler/EDFScheduler.hpp>
+#include <threadPool/scheduler/FIFO_schedule.hpp>
+#include <threadPool/scheduler/LockFreeFIFO_schedule.hpp>
+#include <threadPool/scheduler/PriorityScheduler.hpp>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+// 在容量只有 1 的佇列上以每種 RejectPolicy 執行同一張圖，同時另一條執行緒持續 submit 普通任務：
+// 佇列放不下或被 DROP_OLDEST 擠掉的節點改在派送端執行，每個節點都要剛好執行一次，run() 不能停住
+namespace
+{
+
+constexpr int kChain = 16;
+constexpr int kFan = 8;
+constexpr int kNodes = kChain + kFan + 1;
+
+// root -> (fan 0..7) -> join，另有一條 16 個節點的鏈
+void buildGraph(TaskGraph& graph, std::atomic<int>& counter)
+{
+    // 稍微佔用工作執行緒，讓派送出去的節點在佇列中停留、有機會被擠掉
+    auto work = [&counter] {
+        counter.fetch_add(1, std::memory_order_relaxed);
+        std::this_thread::sleep_for(std::chrono::microseconds(50));
+    };
+
+    TaskGraph::NodeId prev = graph.addNode(work, "chain0");
+    for (int i = 1; i < kChain; ++i)
+    {
+        auto node = graph.addNode(work, "chain");
+        graph.precede(prev, node);
+        prev = node;
+    }
+
+    auto root = graph.addNode(work, "root");
+    auto join = graph.addNode(work, "join");
+    for (int i = 1; i < kFan; ++i)
+    {
+        auto node = graph.addNode(work, "fan");
+        graph.precede(root, node);
+        graph.precede(node, join);
+    }
+    graph.precede(root, join);
+}
+
+std::unique_ptr<IScheduler> makeScheduler(int kind)
+{
+    switch (kind)
+    {
+        case 0:  return std::make_unique<FIFOScheduler>();
+        case 1:  return std::make_unique<PriorityScheduler>();
+        case 2:  return std::make_unique<EDFScheduler>();
+        default: return std::make_unique<LockFreeFIFOScheduler>(1);
+    }
+}
+
+const char* const kSchedulerNames[] = {"FIFO", "Priority", "EDF", "LockFreeFIFO"};
+const char* const kPolicyNames[] = {"BLOCK", "DISCARD", "THROW", "CALLER_RUNS", "DROP_OLDEST"};
+
+} // namespace
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::ERROR);
+
+    const RejectPolicy policies[] = {RejectPolicy::BLOCK, RejectPolicy::DISCARD, RejectPolicy::THROW,
+                                     RejectPolicy::CALLER_RUNS, RejectPolicy::DROP_OLDEST};
+    int failures = 0;
+
+    for (int kind = 0; kind < 4; ++kind)
+    {
+        for (int p = 0; p < 5; ++p)
+        {
+            auto scheduler = makeScheduler(kind);
+            scheduler->setRejectPolicy(policies[p]);
+            scheduler->setMaxQueueSize(1);
+
+            ThreadPool pool(std::move(scheduler));
+            pool.start(1);
+
+            std::atomic<int> counter{0};
+            TaskGraph graph;
+            buildGraph(graph, counter);
+            if (!graph.compile())
+            {
+                std::cerr << "Graph compile failed\n";
+                return 1;
+            }
+
+            // 與圖的節點搶佇列空間；DISCARD / THROW 的拒絕在這裡忽略
+            std::atomic<bool> submitting{true};
+            std::thread submitter([&] {
+                while (submitting.load(std::memory_order_relaxed))
+                {
+                    try {  pool.submit([] {});  } catch (const std::exception&) {}
+                    std::this_thread::yield();
+                }
+            });
+
+            // 以另一條執行緒執行，停住時回報失敗而不是讓範例卡死
+            constexpr int kRuns = 20;
+            auto done = std::async(std::launch::async, [&] {
+                for (int run = 0; run < kRuns; ++run)
+                    pool.run(graph);
+            });
+            const bool finished = done.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+            const bool ok = finished && counter.load() == kNodes * kRuns;
+            if (!ok) ++failures;
+
+            std::cout << kSchedulerNames[kind] << " / " << kPolicyNames[p] << ": "
+                      << counter.load() << " of " << kNodes * kRuns << " node runs"
+                      << (finished ? "" : " (stalled)") << (ok ? "" : "  FAILED") << "\n";
+
+            if (!finished)
+            {
+                std::cerr << "Graph run stalled, aborting\n";
+                std::_Exit(1);
+            }
+            submitting.store(false, std::memory_order_relaxed);
+            submitter.join();
+            pool.stop();
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
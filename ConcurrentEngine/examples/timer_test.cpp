@@ -0,0 +1,47 @@
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <threadPool/threadPool.hpp>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::WARN);
+
+    ThreadPool pool(std::make_unique<FIFOScheduler>());
+    pool.start(2);
+
+    const auto start = std::chrono::steady_clock::now();
+    auto elapsedMs = [start] {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    // 延遲與定時任務在等待期間不佔用工作執行緒
+    pool.submitAfter(std::chrono::milliseconds(200), [&] {
+        std::cout << "[" << elapsedMs() << "ms] submitAfter(200ms)\n";
+    });
+    pool.submitAt(start + std::chrono::milliseconds(100), [&] {
+        std::cout << "[" << elapsedMs() << "ms] submitAt(start + 100ms)\n";
+    });
+
+    // 已取消的計時器不會執行
+    auto cancelled = pool.submitAfter(std::chrono::milliseconds(150), [] {
+        std::cout << "this should not run\n";
+    });
+    std::cout << "cancel: " << std::boolalpha << pool.cancelTimer(cancelled) << "\n";
+
+    std::atomic<int> heartbeats{0};
+    auto heartbeat = pool.submitEvery(std::chrono::milliseconds(50), [&] {
+        std::cout << "[" << elapsedMs() << "ms] heartbeat " << ++heartbeats << "\n";
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(320));
+    pool.cancelTimer(heartbeat);
+    std::cout << "pending timers: " << pool.getTimerCount() << "\n";
+
+    pool.stop();
+    return 0;
+}
@@ -0,0 +1,85 @@
+// try_submit.cpp
+// trySubmit 不阻塞也不拋例外：佇列滿時回傳 QUEUE_FULL，任務留在呼叫端，可以稍後重試或改走其他路徑
+#include <threadPool/threadPool.hpp>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+using namespace ConcurrentEngine;
+using namespace ConcurrentEngine::Scheduler;
+
+namespace
+{
+
+const char* statusName(SubmitStatus status)
+{
+    switch (status)
+    {
+        case SubmitStatus::ACCEPTED:      return "ACCEPTED";
+        case SubmitStatus::QUEUE_FULL:    return "QUEUE_FULL";
+        case SubmitStatus::STOPPED:       return "STOPPED";
+        case SubmitStatus::NOT_SUPPORTED: return "NOT_SUPPORTED";
+    }
+    return "?";
+}
+
+} // namespace
+
+int main()
+{
+    ThreadLogger::getInstance().setLevel(LogLevel::ERROR);
+
+    auto scheduler = std::make_unique<FIFOScheduler>();
+    scheduler->setMaxQueueSize(4);
+
+    ThreadPool pool(std::move(scheduler));
+    pool.start(1);
+
+    std::atomic<int> done{0};
+    int accepted = 0;
+    int full = 0;
+    int retried = 0;
+
+    // 單一工作執行緒、佇列 4 格：快速提交必然遇到 QUEUE_FULL
+    for (int i = 0; i < 20; ++i)
+    {
+        Task task([&done] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            done.fetch_add(1);
+        });
+
+        SubmitStatus status = pool.trySubmit(task);
+        if (status == SubmitStatus::QUEUE_FULL)
+        {
+            ++full;
+            // task 仍在手上：退讓後重試
+            while ((status = pool.trySubmit(task)) == SubmitStatus::QUEUE_FULL)
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++retried;
+        }
+        if (status == SubmitStatus::ACCEPTED)
+            ++accepted;
+    }
+
+    // future 版本：只有 ACCEPTED 時 future 才有效
+    auto [status, answer] = pool.trySubmit([] { return 42; });
+    while (status == SubmitStatus::QUEUE_FULL)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        std::tie(status, answer) = pool.trySubmit([] { return 42; });
+    }
+    std::cout << "[Main] future trySubmit: " << statusName(status) << ", answer " << answer.get() << "\n";
+
+    while (done.load() < accepted)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    std::cout << "[Main] accepted " << accepted << " / 20, hit QUEUE_FULL " << full
+              << " times, all " << retried << " retried without losing the task\n";
+
+    pool.stop();
+
+    Task late([] {});
+    std::cout << "[Main] after stop: " << statusName(pool.trySubmit(late)) << "\n";
+    return 0;
+}
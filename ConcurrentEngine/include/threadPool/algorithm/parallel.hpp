@@ -0,0 +1,236 @@
+#ifndef CONCURRENTENGINE_ALGORITHM_PARALLEL_HPP
+#define CONCURRENTENGINE_ALGORITHM_PARALLEL_HPP
+
+#include <threadPool/basicThreadPool.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ConcurrentEngine
+{
+
+namespace detail
+{
+
+// 一次平行迴圈的共享狀態，由呼叫端與 helper 任務共同持有
+struct ParallelState
+{
+    size_t total = 0;
+    size_t minGrain = 1;
+    size_t participants = 1;
+
+    std::atomic<size_t> next{0};   // 下一個尚未被領取的索引
+    std::atomic<size_t> done{0};   // 已完成（或因例外被跳過）的元素數
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::exception_ptr error;
+
+    // guided 切分：剩餘量越多 chunk 越大，尾端逐漸縮小到 minGrain，兼顧負載平衡與領取次數
+    bool claim(size_t& lo, size_t& hi)
+    {
+        size_t cur = next.load(std::memory_order_relaxed);
+        while (cur < total)
+        {
+            size_t remaining = total - cur;
+            size_t chunk = std::max(minGrain, remaining / (2 * participants));
+            chunk = std::min(chunk, remaining);
+            if (next.compare_exchange_weak(cur, cur + chunk, std::memory_order_relaxed))
+            {
+                lo = cur;
+                hi = cur + chunk;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void finish(size_t count)
+    {
+        if (done.fetch_add(count, std::memory_order_acq_rel) + count == total)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            cv.notify_all();
+        }
+    }
+
+    // 記錄第一個例外，並把尚未領取的範圍一次標記為完成
+    void fail(std::exception_ptr e)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (!error)
+                error = std::move(e);
+        }
+        size_t old = next.exchange(total, std::memory_order_relaxed);
+        if (old < total)
+            finish(total - old);
+    }
+
+    template<typename Body>
+    void run(Body& body)
+    {
+        size_t lo = 0, hi = 0;
+        while (claim(lo, hi))
+        {
+            try
+            {  body(lo, hi);  }
+            catch (...)
+            {  fail(std::current_exception());  }
+            finish(hi - lo);
+        }
+    }
+
+    void wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return done.load(std::memory_order_acquire) == total; });
+    }
+};
+
+// 將 [0, n) 切成 chunk 交給 pool 與呼叫端共同執行，body(lo, hi) 處理半開區間
+// 呼叫端會一起領取 chunk 而不是單純等待，因此在工作執行緒內巢狀呼叫也不會死結
+template<typename SchedulerT, typename Body>
+void parallelChunks(BasicThreadPool<SchedulerT>& pool, size_t n, size_t grain, Body&& body)
+{
+    if (n == 0) return;
+
+    const size_t workers = pool.getCurThreadCount();
+    const size_t participants = workers + 1;
+
+    // 未指定 grain 時，讓每個參與者至少分到數十個 chunk，避免尾端等待最後一個大 chunk
+    const size_t minGrain = grain > 0 ? grain : std::max<size_t>(1, n / (participants * 32));
+
+    if (workers == 0 || n <= minGrain)
+    {
+        body(size_t{0}, n);
+        return;
+    }
+
+    auto state = std::make_shared<ParallelState>();
+    state->total = n;
+    state->minGrain = minGrain;
+    state->participants = participants;
+
+    // helper 只在成功領取 chunk 時才會碰 body，而此時呼叫端必定仍在 wait() 中
+    auto* bodyPtr = &body;
+    const size_t helpers = std::min(workers, (n + minGrain - 1) / minGrain - 1);
+
+    std::vector<Scheduler::Task> tasks;
+    tasks.reserve(helpers);
+    for (size_t i = 0; i < helpers; ++i)
+        tasks.emplace_back([state, bodyPtr] { state->run(*bodyPtr); });
+
+    // 提交失敗（例如 DAG Scheduler 或佇列已滿）時由呼叫端獨自完成
+    try
+    {  pool.submitBatch(std::span<Scheduler::Task>(tasks));  }
+    catch (const std::exception& e)
+    {  LOG_WARN("[parallel] Helper submit failed, running inline: {}", e.what());  }
+
+    state->run(body);
+    state->wait();
+
+    if (state->error)
+        std::rethrow_exception(state->error);
+}
+
+// 整數索引直接傳入，迭代器則傳入解參考後的元素
+template<typename It>
+decltype(auto) elementAt(It begin, size_t i)
+{
+    if constexpr (std::is_integral_v<It>)
+        return static_cast<It>(begin + static_cast<It>(i));
+    else
+        return *(begin + static_cast<std::iter_difference_t<It>>(i));
+}
+
+template<typename It>
+size_t distanceOf(It begin, It end)
+{
+    if constexpr (std::is_integral_v<It>)
+        return end > begin ? static_cast<size_t>(end - begin) : 0;
+    else
+        return static_cast<size_t>(std::max<std::iter_difference_t<It>>(0, end - begin));
+}
+
+template<typename It>
+concept ParallelIndex = std::is_integral_v<It> || std::random_access_iterator<It>;
+
+} // namespace detail
+
+// 對 [begin, end) 的每個索引（或元素）呼叫 fn；grain 為 0 時自動選擇
+template<typename SchedulerT, detail::ParallelIndex It, typename Func>
+void parallel_for(BasicThreadPool<SchedulerT>& pool, It begin, It end, Func&& fn, size_t grain = 0)
+{
+    detail::parallelChunks(pool, detail::distanceOf(begin, end), grain,
+        [&](size_t lo, size_t hi)
+        {
+            for (size_t i = lo; i < hi; ++i)
+                fn(detail::elementAt(begin, i));
+        });
+}
+
+// out[i] = fn(in[i])，輸出範圍須至少與輸入等長；回傳輸出的尾端
+template<typename SchedulerT, std::random_access_iterator InIt, std::random_access_iterator OutIt, typename Func>
+OutIt parallel_transform(BasicThreadPool<SchedulerT>& pool, InIt first, InIt last, OutIt out, Func&& fn,
+                         size_t grain = 0)
+{
+    const size_t n = detail::distanceOf(first, last);
+    detail::parallelChunks(pool, n, grain,
+        [&](size_t lo, size_t hi)
+        {
+            for (size_t i = lo; i < hi; ++i)
+                out[static_cast<std::iter_difference_t<OutIt>>(i)] =
+                    fn(first[static_cast<std::iter_difference_t<InIt>>(i)]);
+        });
+    return out + static_cast<std::iter_difference_t<OutIt>>(n);
+}
+
+// 以 reduce 合併 transform(element)，identity 為 reduce 的單位元素
+// 各 chunk 的部分結果依索引順序合併，reduce 只需滿足結合律
+template<typename SchedulerT, detail::ParallelIndex It, typename T, typename Reduce, typename Transform>
+    requires (!std::is_convertible_v<Transform, size_t>)
+T parallel_reduce(BasicThreadPool<SchedulerT>& pool, It begin, It end, T identity,
+                  Reduce&& reduce, Transform&& transform, size_t grain = 0)
+{
+    std::mutex partialMutex;
+    std::vector<std::pair<size_t, T>> partials;
+
+    detail::parallelChunks(pool, detail::distanceOf(begin, end), grain,
+        [&](size_t lo, size_t hi)
+        {
+            T acc = identity;
+            for (size_t i = lo; i < hi; ++i)
+                acc = reduce(std::move(acc), transform(detail::elementAt(begin, i)));
+
+            std::lock_guard<std::mutex> lock(partialMutex);
+            partials.emplace_back(lo, std::move(acc));
+        });
+
+    std::sort(partials.begin(), partials.end(),
+              [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    T result = std::move(identity);
+    for (auto& [lo, value] : partials)
+        result = reduce(std::move(result), std::move(value));
+    return result;
+}
+
+template<typename SchedulerT, detail::ParallelIndex It, typename T, typename Reduce>
+T parallel_reduce(BasicThreadPool<SchedulerT>& pool, It begin, It end, T identity, Reduce&& reduce,
+                  size_t grain = 0)
+{
+    return parallel_reduce(pool, begin, end, std::move(identity), std::forward<Reduce>(reduce),
+                           [](auto&& x) -> decltype(auto) { return std::forward<decltype(x)>(x); }, grain);
+}
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_ALGORITHM_PARALLEL_HPP
@@ -0,0 +1,1216 @@
+#ifndef CONCURRENTENGINE_BASICTHREADPOOL_HPP
+#define CONCURRENTENGINE_BASICTHREADPOOL_HPP
+
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <chrono>
+#include <unordered_map>
+#include <type_traits>
+#include <concepts>
+#include <ranges>
+#include <span>
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cstdio>
+#include <coroutine>
+#include <threadPool/scheduler/FIFO_schedule.hpp>
+#include <threadPool/scheduler/LockFreeFIFO_schedule.hpp>
+#include <threadPool/scheduler/DAGschedule.hpp>
+#include <threadPool/scheduler/PriorityScheduler.hpp>
+#include <threadPool/scheduler/WorkStealingScheduler.hpp>
+#include <threadPool/scheduler/EDFScheduler.hpp>
+#include <threadPool/scheduler/taskGraph.hpp>
+#include <threadPool/logger/threadLogger.hpp>
+#include <threadPool/core/threadMeta.hpp>
+#include <threadPool/core/poolMetrics.hpp>
+#include <threadPool/core/cpuTopology.hpp>
+#include <threadPool/core/promiseTask.hpp>
+#include <threadPool/core/cancellation.hpp>
+#include <threadPool/core/future.hpp>
+#include <threadPool/coroutine/coroTask.hpp>
+#include <threadPool/core/timingWheel.hpp>
+
+namespace ConcurrentEngine 
+{
+
+enum class PoolMode { MODE_SINGLE, MODE_FIXED, MODE_CACHED };
+
+struct ThreadPoolState 
+{
+    std::atomic<size_t> taskCount{0};        // 已執行完成的任務數
+    std::atomic<size_t> submitCount{0};
+    std::atomic<size_t> failedCount{0};
+    std::atomic<size_t> curThreadCount{0};
+    std::atomic<size_t> freeThread{0};
+    std::atomic<int> threadIDCounter{0};
+    std::atomic<bool> isRunning{false};
+
+    size_t initThreadCount = 0;
+    size_t maxThreadCount = 0;
+    size_t taskQueueMaxSize = 0;
+    PoolMode poolmode = PoolMode::MODE_FIXED;
+
+    // MODE_CACHED：閒置超過 threadIdleTimeout 的執行緒會被回收（至少保留 initThreadCount 條）
+    std::chrono::milliseconds threadIdleTimeout{std::chrono::seconds(15)};
+    std::atomic<int64_t> lastScaleUpNs{0};  // 最近一次擴充的 steady_clock 時間
+    std::atomic<bool> scaling{false};       // 同一時間只允許一個提交者建立執行緒
+
+    std::mutex taskQueueMutex;
+    std::mutex threadMapMutex;
+    std::condition_variable notFull;
+    std::condition_variable notNull;
+};
+
+// SchedulerT 在編譯期決定：
+// - 具體的 Scheduler（例如 FIFOScheduler）：priority / DAG 提交在編譯期決議，getTask 不經過虛擬呼叫
+// - Scheduler::IScheduler：執行期多型，即 ThreadPool，可用 setScheduler 更換
+template<typename SchedulerT>
+class BasicThreadPool 
+{
+    static_assert(std::is_base_of_v<Scheduler::IScheduler, SchedulerT>,
+                  "SchedulerT must implement Scheduler::IScheduler");
+
+public:
+    using scheduler_type = SchedulerT;
+
+    static constexpr bool isPolymorphic = std::is_same_v<SchedulerT, Scheduler::IScheduler>;
+
+    using TimerId = TimingWheel::TimerId;
+
+    BasicThreadPool()
+        : state_(std::make_shared<ThreadPoolState>())
+        , timers_(std::make_unique<TimingWheel>(this, &BasicThreadPool::dispatchTasks))
+    {}
+
+    explicit BasicThreadPool(std::unique_ptr<SchedulerT> scheduler)
+        : scheduler_(std::move(scheduler))
+        , state_(std::make_shared<ThreadPoolState>())
+        , timers_(std::make_unique<TimingWheel>(this, &BasicThreadPool::dispatchTasks))
+    {  classifyScheduler();  }
+
+    // 時間輪的派送目標與工作執行緒都持有 this，不可複製或移動
+    BasicThreadPool(const BasicThreadPool&) = delete;
+    BasicThreadPool& operator=(const BasicThreadPool&) = delete;
+    BasicThreadPool(BasicThreadPool&&) = delete;
+    BasicThreadPool& operator=(BasicThreadPool&&) = delete;
+
+    // MODE_SINGLE 固定 1 條；MODE_FIXED 固定 threadCount 條；
+    // MODE_CACHED 以 threadCount 為下限，依佇列深度擴充到 maxThreadCount
+    // placement 決定工作執行緒綁定的 CPU / NUMA node（擴充出的執行緒沿用同一策略）
+    void start(int threadCount, PlacementPolicy placement = {});
+    void stop();
+
+    // 以下設定須在 start() 前呼叫
+    void setMode(PoolMode mode) {  state_->poolmode = mode;  }
+    void setMaxThreadCount(size_t maxCount) {  state_->maxThreadCount = maxCount;  }
+    void setThreadIdleTimeout(std::chrono::milliseconds timeout) {  state_->threadIdleTimeout = timeout;  }
+
+    // 工作執行緒閒置時先 spin、再 yield、最後休眠；預設 WaitStrategy::balanced()
+    // 延遲敏感可用 lowLatency()，與其他程式共用 CPU 時可用 blocking()
+    void setWaitStrategy(WaitStrategy strategy) {  waitStrategy_ = strategy;  }
+    WaitStrategy getWaitStrategy() const {  return waitStrategy_;  }
+
+    PoolMode getMode() const { return state_->poolmode; }
+
+    // 執行緒數、佇列深度、排隊 / 執行時間直方圖與各工作執行緒的忙碌比例
+    MetricsSnapshot metricsSnapshot() const;
+
+    // 以 metricsSnapshot() 輸出摘要到 stdout
+    void reportStatus() const;
+
+    void setScheduler(std::unique_ptr<SchedulerT> scheduler) 
+    {  
+        scheduler_ = std::move(scheduler);
+        classifyScheduler();
+    }
+
+    SchedulerT* scheduler() const { return scheduler_.get(); }
+
+    void submit(Scheduler::Task task);
+    // priority 可為 TaskPriority 或 0（最高）~ 255 的數值，只有 PriorityScheduler 會使用
+    bool submit(Scheduler::Task task, Scheduler::Priority priority);
+
+    // 不阻塞、不拋例外的提交：不套用 RejectPolicy，佇列已滿時回傳 QUEUE_FULL，
+    // 只有 ACCEPTED 時才會移走 task，其餘情況任務留在呼叫端可稍後重試或自行處理
+    Scheduler::SubmitStatus trySubmit(Scheduler::Task& task,
+                                      Scheduler::Priority priority = Scheduler::TaskPriority::MEDIUM);
+
+    // 帶絕對期限的提交：EDFScheduler 依期限排序，開始前已過期的任務不執行，
+    // 回傳 future 的版本會收到 Scheduler::DeadlineExpired；其他 Scheduler 忽略期限
+    bool submitWithDeadline(Scheduler::Task task, Scheduler::Deadline deadline);
+
+    // group 不為空時，節點完成會計入該組的完成通知；形成循環的依賴會被拒絕
+    bool submitDAG(std::shared_ptr<Scheduler::TaskNode> node,
+                   const std::vector<std::shared_ptr<Scheduler::TaskNode>>& deps,
+                   Scheduler::DAGHandle group = nullptr);
+
+    // 批次提交：Scheduler 只取一次鎖、最後一次喚醒至多 N 個工作執行緒
+    // tasks 內的元素會被移走；DAG Scheduler 不接受批次提交
+    bool submitBatch(std::span<Scheduler::Task> tasks,
+                     Scheduler::Priority priority = Scheduler::TaskPriority::MEDIUM);
+
+    // 執行一次已 compile() 的 TaskGraph 並等待完成，呼叫端也會執行節點；重新拋出第一個節點例外
+    // 任何 Scheduler 皆可（DAGScheduler 把節點當作無依賴的就緒任務），PriorityScheduler 以 MEDIUM 排入
+    void run(Scheduler::TaskGraph& graph);
+
+    // 批次提交一組可呼叫物件，依序回傳對應的 future
+    template<std::ranges::input_range Range>
+        requires std::invocable<std::decay_t<std::ranges::range_reference_t<Range>>&> &&
+                 (!std::is_same_v<std::ranges::range_value_t<Range>, Scheduler::Task>)
+    auto submitBatch(Range&& callables,
+                     Scheduler::Priority priority = Scheduler::TaskPriority::MEDIUM)
+        -> std::vector<std::future<BoundResult<std::ranges::range_reference_t<Range>>>>
+    {
+        std::vector<Scheduler::Task> tasks;
+        std::vector<std::future<BoundResult<std::ranges::range_reference_t<Range>>>> futures;
+        if constexpr (std::ranges::sized_range<Range>)
+        {
+            tasks.reserve(std::ranges::size(callables));
+            futures.reserve(std::ranges::size(callables));
+        }
+
+        for (auto&& f : callables)
+        {
+            auto [task, future] = makePromiseTask(std::forward<decltype(f)>(f));
+            tasks.emplace_back(std::move(task));
+            futures.push_back(std::move(future));
+        }
+
+        LOG_INFO("[submitBatch] {} tasks (priority={})", tasks.size(), static_cast<int>(priority.level));
+
+        if (!submitBatch(std::span<Scheduler::Task>(tasks), priority))
+            throw std::runtime_error("[ThreadPool::submitBatch] Submit failed");
+
+        return futures;
+    }
+
+    // 回傳 future 的提交：promise 與呼叫物件一起存放在 Task 內部，小型閉包不需額外配置
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submit(const std::string& name, Scheduler::Priority priority, Func&& f, Args&&... args)
+        -> std::future<BoundResult<Func, Args...>>
+    {
+        auto [task, future] = makePromiseTask(std::forward<Func>(f), std::forward<Args>(args)...);
+
+        LOG_INFO("[submit] {} (priority={})", name, static_cast<int>(priority.level));
+
+        if (!this->submit(Scheduler::Task(std::move(task)), priority))
+            throw std::runtime_error("[ThreadPool::submit] Submit failed");
+
+        return std::move(future);
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submitWithDeadline(Scheduler::Deadline deadline, Func&& f, Args&&... args)
+        -> std::future<BoundResult<Func, Args...>>
+    {
+        auto [task, future] = makePromiseTask(std::forward<Func>(f), std::forward<Args>(args)...);
+
+        if (!submitWithDeadline(Scheduler::Task(std::move(task)), deadline))
+            throw std::runtime_error("[ThreadPool::submitWithDeadline] Submit failed");
+
+        return std::move(future);
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submit(Scheduler::Priority priority, Func&& f, Args&&... args)
+    {
+        return submit("UnnamedTask", priority, std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submit(const std::string& name, Func&& f, Args&&... args)
+    {
+        return submit(name, Scheduler::TaskPriority::MEDIUM, std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submit(Func&& f, Args&&... args)
+    {
+        return submit("UnnamedTask", Scheduler::TaskPriority::MEDIUM, std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+
+    // trySubmit 的 future 版本：只有 status 為 ACCEPTED 時 future 才有效
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto trySubmit(Scheduler::Priority priority, Func&& f, Args&&... args)
+        -> std::pair<Scheduler::SubmitStatus, std::future<BoundResult<Func, Args...>>>
+    {
+        auto [task, future] = makePromiseTask(std::forward<Func>(f), std::forward<Args>(args)...);
+        Scheduler::Task wrapped(std::move(task));
+
+        const auto status = trySubmit(wrapped, priority);
+        if (status != Scheduler::SubmitStatus::ACCEPTED)
+            return {status, std::future<BoundResult<Func, Args...>>()};
+        return {status, std::move(future)};
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto trySubmit(Func&& f, Args&&... args)
+    {
+        return trySubmit(Scheduler::TaskPriority::MEDIUM, std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+
+    // 可取消的提交：token 被取消時，尚未開始的任務在取出時直接放棄（future 收到 TaskCancelled），
+    // 執行中的任務可用 cancellationRequested() 輪詢；同一個 token 可交給同一個請求的所有任務
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submit(CancellationToken token, Scheduler::Priority priority, Func&& f, Args&&... args)
+        -> TaskHandle<BoundResult<Func, Args...>>
+    {
+        auto [task, future] = makePromiseTask(std::forward<Func>(f), std::forward<Args>(args)...);
+
+        LOG_INFO("[submit] Cancellable task (priority={})", static_cast<int>(priority.level));
+
+        using Inner = decltype(task);
+        if (!this->submit(Scheduler::Task(CancellableTask<Inner>{token, std::move(task)}), priority))
+            throw std::runtime_error("[ThreadPool::submit] Submit failed");
+
+        return TaskHandle<BoundResult<Func, Args...>>(std::move(future), std::move(token));
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto submit(CancellationToken token, Func&& f, Args&&... args)
+    {
+        return submit(std::move(token), Scheduler::TaskPriority::MEDIUM, std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+
+    template<typename Func>
+        requires std::invocable<std::decay_t<Func>&>
+    auto submitDAG(const std::string& name, Func&& f,
+                   const std::vector<std::shared_ptr<Scheduler::TaskNode>>& deps = {},
+                   Scheduler::DAGHandle group = nullptr)
+        -> std::future<BoundResult<Func>>
+    {
+        auto [task, future] = makePromiseTask(std::forward<Func>(f));
+        auto node = std::make_shared<Scheduler::TaskNode>(Scheduler::Task(std::move(task)));
+
+        LOG_INFO("[submitDAG] {}", name);
+
+        if (!this->submitDAG(node, deps, std::move(group)))
+            throw std::runtime_error("[ThreadPool::submitDAG] Submit DAG task failed");
+
+        return std::move(future);
+    }
+
+    // 可取消的 DAG 節點：取消後節點不執行，所有下游節點也跟著放棄（future 與 group 收到 TaskCancelled）
+    // 下游節點以 node() 取得的 TaskNode 作為依賴
+    template<typename Func>
+        requires std::invocable<std::decay_t<Func>&>
+    auto submitDAG(CancellationToken token, Func&& f,
+                   const std::vector<std::shared_ptr<Scheduler::TaskNode>>& deps = {},
+                   Scheduler::DAGHandle group = nullptr)
+        -> std::pair<std::shared_ptr<Scheduler::TaskNode>, TaskHandle<BoundResult<Func>>>
+    {
+        auto [task, future] = makePromiseTask(std::forward<Func>(f));
+        auto node = std::make_shared<Scheduler::TaskNode>(Scheduler::Task(std::move(task)), 1.0, token);
+
+        LOG_INFO("[submitDAG] Cancellable node");
+
+        if (!this->submitDAG(node, deps, std::move(group)))
+            throw std::runtime_error("[ThreadPool::submitDAG] Submit DAG task failed");
+
+        return {std::move(node), TaskHandle<BoundResult<Func>>(std::move(future), std::move(token))};
+    }
+
+    template<typename Func>
+        requires std::invocable<std::decay_t<Func>&>
+    auto submitDAG(Func&& f,
+                   const std::vector<std::shared_ptr<Scheduler::TaskNode>>& deps = {},
+                   Scheduler::DAGHandle group = nullptr)
+    {
+        return submitDAG("UnnamedDAGTask", std::forward<Func>(f), deps, std::move(group));
+    }
+
+    // 協程：co_await pool.schedule(priority) 之後的程式在工作執行緒上繼續
+    // 恢復本身是一個經過目前 Scheduler 的任務，優先級與 FIFO 順序照常生效；
+    // 被拒絕或放棄時協程在當下的執行緒恢復，並在 co_await 處收到例外
+    class ScheduleAwaiter
+    {
+    public:
+        ScheduleAwaiter(BasicThreadPool* pool, Scheduler::Priority priority) : pool_(pool), priority_(priority) {}
+
+        bool await_ready() const noexcept {  return false;  }
+
+        // 交出後協程可能已在其他執行緒恢復，之後不能再使用 this
+        void await_suspend(std::coroutine_handle<> handle)
+        {  postTask(pool_, Scheduler::Task(ResumeTask(handle, &error_)), priority_.level);  }
+
+        void await_resume() const
+        {
+            if (error_)
+                std::rethrow_exception(error_);
+        }
+
+    private:
+        BasicThreadPool* pool_;
+        Scheduler::Priority priority_;
+        std::exception_ptr error_;
+    };
+
+    ScheduleAwaiter schedule(Scheduler::Priority priority = Scheduler::TaskPriority::MEDIUM)
+    {  return ScheduleAwaiter(this, priority);  }
+
+    // Future 的接續經由這個 Executor 交回目前的 Scheduler
+    Executor executor(Scheduler::Priority priority = Scheduler::TaskPriority::MEDIUM)
+    {  return Executor{this, &BasicThreadPool::postTask, priority.level};  }
+
+    // 回傳可 co_await 的 Future：等待的協程在結果就緒後才經由 Scheduler 恢復，不佔用工作執行緒
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto async(Scheduler::Priority priority, Func&& f, Args&&... args)
+        -> Future<BoundResult<Func, Args...>>
+    {
+        auto [task, future] = makeFutureTask(executor(priority), std::forward<Func>(f), std::forward<Args>(args)...);
+
+        if (!this->submit(Scheduler::Task(std::move(task)), priority))
+            throw std::runtime_error("[ThreadPool::async] Submit failed");
+
+        return std::move(future);
+    }
+
+    template<typename Func, typename... Args>
+        requires std::invocable<std::decay_t<Func>&, std::decay_t<Args>&...>
+    auto async(Func&& f, Args&&... args)
+    {
+        return async(Scheduler::TaskPriority::MEDIUM, std::forward<Func>(f), std::forward<Args>(args)...);
+    }
+
+    // 在工作執行緒上開始一個協程任務，回傳它的 Future
+    template<typename T>
+    Future<T> spawn(Coro::Task<T> task, Scheduler::Priority priority = Scheduler::TaskPriority::MEDIUM)
+    {
+        auto state = detail::makeFutureState<T>(executor(priority));
+        runSpawned(this, priority, std::move(task), state);
+        return Future<T>(std::move(state));
+    }
+
+    // 延遲 / 定時 / 週期任務：由時間輪的計時執行緒在到期時交給目前的 Scheduler，等待期間不佔用工作執行緒
+    // 回傳的 TimerId 可用 cancelTimer() 以 O(1) 取消；pool 未執行時回傳 TimingWheel::kInvalidTimer
+    // stop() 時尚未到期的計時器會被丟棄
+    template<typename Func>
+        requires std::invocable<std::decay_t<Func>&>
+    TimerId submitAt(std::chrono::steady_clock::time_point when, Func&& f)
+    {  return scheduleTimer(when, Scheduler::Task(std::forward<Func>(f)), {});  }
+
+    template<typename Rep, typename Period, typename Func>
+        requires std::invocable<std::decay_t<Func>&>
+    TimerId submitAfter(std::chrono::duration<Rep, Period> delay, Func&& f)
+    {  return submitAt(std::chrono::steady_clock::now() + delay, std::forward<Func>(f));  }
+
+    // 固定速率，第一次在一個週期後執行；上一次還沒執行完時跳過該次
+    template<typename Rep, typename Period, typename Func>
+        requires std::invocable<std::decay_t<Func>&>
+    TimerId submitEvery(std::chrono::duration<Rep, Period> period, Func&& f)
+    {
+        const auto interval = std::chrono::duration_cast<std::chrono::nanoseconds>(period);
+        if (interval.count() <= 0)
+            throw std::invalid_argument("[ThreadPool::submitEvery] Period must be positive");
+        return scheduleTimer(std::chrono::steady_clock::now() + interval, Scheduler::Task(std::forward<Func>(f)), interval);
+    }
+
+    bool cancelTimer(TimerId id) {  return timers_->cancel(id);  }
+    size_t getTimerCount() const {  return timers_->size();  }
+
+    size_t getCurThreadCount() const { return state_ ? state_->curThreadCount.load() : 0; }
+    size_t getFreeThreadCount() const { return state_ ? state_->freeThread.load() : 0; }
+    size_t getTaskCount() const { return state_ ? state_->taskCount.load() : 0; }
+    size_t getQueueSize() const { return scheduler_ ? scheduler_->size() : 0; }
+
+    std::shared_ptr<ThreadMeta> getThreadMeta(int tid);
+    void workerThreadFunc(int threadId);
+
+private:
+    void spawnWorker();
+    void reapRetired();
+    void maybeScaleUp();
+    bool tryRetire(const ThreadMeta& meta);
+    static void dispatchTasks(void* self, std::span<Scheduler::Task> tasks);
+    static void dispatchGraphTasks(void* self, std::span<Scheduler::Task> tasks);
+    static void postTask(void* self, Scheduler::Task task, uint8_t level);
+
+    // schedule() 交出的恢復任務：執行時恢復協程；被放棄或沒有執行就解構時帶著錯誤恢復
+    class ResumeTask
+    {
+    public:
+        ResumeTask(std::coroutine_handle<> handle, std::exception_ptr* error) : handle_(handle), error_(error) {}
+        ResumeTask(ResumeTask&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)), error_(other.error_) {}
+        ResumeTask& operator=(ResumeTask&&) = delete;
+
+        ~ResumeTask()
+        {
+            if (handle_)
+                fail(std::make_exception_ptr(std::runtime_error("[ThreadPool] Coroutine resumption dropped")));
+        }
+
+        void operator()() {  std::exchange(handle_, nullptr).resume();  }
+
+        void fail(std::exception_ptr error)
+        {
+            *error_ = std::move(error);
+            std::exchange(handle_, nullptr).resume();
+        }
+
+    private:
+        std::coroutine_handle<> handle_;
+        std::exception_ptr* error_;
+    };
+
+    template<typename T>
+    static Coro::detail::Detached runSpawned(BasicThreadPool* pool, Scheduler::Priority priority,
+                                             Coro::Task<T> task, std::shared_ptr<detail::FutureState<T>> state)
+    {
+        try
+        {
+            co_await pool->schedule(priority);
+            if constexpr (std::is_void_v<T>)
+            {
+                co_await std::move(task);
+                state->setValue();
+            }
+            else
+            {
+                state->setValue(co_await std::move(task));
+            }
+        }
+        catch (...)
+        {  state->setException(std::current_exception());  }
+    }
+    TimerId scheduleTimer(std::chrono::steady_clock::time_point when, Scheduler::Task task, std::chrono::nanoseconds period);
+
+    // 執行期多型時，只在設定 Scheduler 時判斷一次種類，取代每次提交的 dynamic_cast
+    enum class SchedulerKind { GENERIC, PRIORITY, DAG, EDF };
+
+    void classifyScheduler()
+    {
+        if constexpr (isPolymorphic)
+        {
+            if (dynamic_cast<Scheduler::DAGScheduler*>(scheduler_.get()))
+                kind_ = SchedulerKind::DAG;
+            else if (dynamic_cast<Scheduler::PriorityScheduler*>(scheduler_.get()))
+                kind_ = SchedulerKind::PRIORITY;
+            else if (dynamic_cast<Scheduler::EDFScheduler*>(scheduler_.get()))
+                kind_ = SchedulerKind::EDF;
+            else
+                kind_ = SchedulerKind::GENERIC;
+        }
+    }
+
+    std::unique_ptr<SchedulerT> scheduler_;
+    SchedulerKind kind_ = SchedulerKind::GENERIC;
+    std::unordered_map<int, std::thread> workers_;  // 受 threadMapMutex 保護
+    std::vector<std::thread> retired_;              // 已回收、尚未 join 的執行緒
+    std::shared_ptr<ThreadPoolState> state_;
+    std::unique_ptr<TimingWheel> timers_;
+    std::unordered_map<int, std::shared_ptr<ThreadMeta>> threadMetas_;
+
+    // 已回收執行緒的統計（受 threadMapMutex 保護）
+    HistogramSnapshot retiredQueueWait_;
+    HistogramSnapshot retiredExecTime_;
+    std::chrono::steady_clock::duration retiredBusy_{0};
+    std::chrono::steady_clock::duration retiredIdle_{0};
+    PlacementPolicy placement_;
+    WaitStrategy waitStrategy_ = WaitStrategy::balanced();
+};
+
+
+// 啟動 ThreadPool，建立指定數量的工作執行緒
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::start(int threadCount, PlacementPolicy placement)
+{
+    if (state_->isRunning) return;
+
+    placement_ = std::move(placement);
+    scheduler_->setWaitStrategy(waitStrategy_);
+
+    size_t count = threadCount > 0 ? static_cast<size_t>(threadCount) : 1;
+    switch (state_->poolmode)
+    {
+        case PoolMode::MODE_SINGLE:
+            count = 1;
+            break;
+        case PoolMode::MODE_FIXED:
+            break;
+        case PoolMode::MODE_CACHED:
+            // 未設定上限時，允許擴充到硬體執行緒數
+            if (state_->maxThreadCount < count)
+                state_->maxThreadCount = std::max<size_t>(count, std::thread::hardware_concurrency());
+            break;
+    }
+    state_->initThreadCount = count;
+
+    LOG_INFO("[ThreadPool] Starting with {} threads.", count);
+
+    // 必須在建立執行緒前設定，否則工作執行緒可能看到 isRunning == false 而直接結束
+    state_->isRunning = true;
+
+    {
+        std::lock_guard<std::mutex> lock(state_->threadMapMutex);
+        for (size_t i = 0; i < count; ++i)
+            spawnWorker();
+    }
+
+    LOG_INFO("[ThreadPool] State set to running.");
+}
+
+// 停止 ThreadPool，通知所有工作執行緒結束並等待它們 join
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::stop()
+{
+    if (!state_->isRunning) return;
+
+    state_->isRunning = false;
+
+    // 先停計時執行緒，之後不會再有任務交給 Scheduler
+    timers_->stop();
+
+    scheduler_->notifyAll(); // 通知 Scheduler 停止，喚醒所有阻塞執行緒
+    LOG_INFO("[ThreadPool] Stopping...");
+
+    // 先取出再 join：回收中的執行緒結束前仍需要 threadMapMutex
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(state_->threadMapMutex);
+        for (auto& [id, t] : workers_)
+            threads.push_back(std::move(t));
+        workers_.clear();
+
+        for (auto& t : retired_)
+            threads.push_back(std::move(t));
+        retired_.clear();
+    }
+
+    for (auto& t : threads)
+    {
+        if (t.joinable())
+            t.join();
+    }
+
+    LOG_INFO("[ThreadPool] All worker threads joined.");
+    ThreadLogger::getInstance().flush();
+}
+
+// 建立一條工作執行緒；呼叫端須持有 threadMapMutex
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::spawnWorker()
+{
+    int threadId = state_->threadIDCounter++;
+    auto meta = std::make_shared<ThreadMeta>(threadId);
+
+    // 位置在建立時決定，工作執行緒啟動後才實際綁定
+    WorkerPlacement where = resolvePlacement(placement_, static_cast<size_t>(threadId));
+    meta->cpu = where.cpu;
+    meta->numaNode = where.numaNode;
+    threadMetas_[threadId] = std::move(meta);
+
+    state_->curThreadCount++;
+    state_->freeThread++;
+    workers_.emplace(threadId, std::thread(&BasicThreadPool::workerThreadFunc, this, threadId));
+}
+
+// join 已回收的執行緒；呼叫端須持有 threadMapMutex
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::reapRetired()
+{
+    for (auto& t : retired_)
+    {
+        if (t.joinable())
+            t.join();
+    }
+    retired_.clear();
+}
+
+// MODE_CACHED：佇列深度超過閒置執行緒數時擴充一條，直到 maxThreadCount
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::maybeScaleUp()
+{
+    if (state_->curThreadCount.load() >= state_->maxThreadCount) return;
+    if (scheduler_->size() <= state_->freeThread.load()) return;
+
+    bool expected = false;
+    if (!state_->scaling.compare_exchange_strong(expected, true)) return;
+
+    {
+        std::lock_guard<std::mutex> lock(state_->threadMapMutex);
+        reapRetired();
+
+        if (state_->isRunning && state_->curThreadCount.load() < state_->maxThreadCount)
+        {
+            spawnWorker();
+            state_->lastScaleUpNs = std::chrono::steady_clock::now().time_since_epoch().count();
+            LOG_DEBUG("[ThreadPool] Scaled up to {} threads.", state_->curThreadCount.load());
+        }
+    }
+
+    state_->scaling = false;
+}
+
+// 閒置逾時的執行緒是否結束。遲滯：最近一次擴充後未滿一個 idle timeout 不回收，
+// 避免突發流量剛擴充的執行緒在下一波之前就被收掉；並保留 initThreadCount 條
+template<typename SchedulerT>
+bool BasicThreadPool<SchedulerT>::tryRetire(const ThreadMeta& meta)
+{
+    const auto timeout = state_->threadIdleTimeout;
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    const auto sinceScaleUp = now - std::chrono::steady_clock::duration(state_->lastScaleUpNs.load());
+
+    if (sinceScaleUp < timeout || !meta.shouldRecycle(timeout))
+        return false;
+
+    size_t cur = state_->curThreadCount.load();
+    while (cur > state_->initThreadCount)
+    {
+        if (state_->curThreadCount.compare_exchange_weak(cur, cur - 1))
+            return true;
+    }
+    return false;
+}
+
+// 依 threadId 取得 ThreadMeta（紀錄該執行緒狀態）
+template<typename SchedulerT>
+std::shared_ptr<ThreadMeta> BasicThreadPool<SchedulerT>::getThreadMeta(int tid)
+{
+    std::lock_guard<std::mutex> lock(state_->threadMapMutex);
+    auto it = threadMetas_.find(tid);
+    if (it != threadMetas_.end())
+            return it->second;
+    else
+        return nullptr;
+}
+
+// 支援以 threadId 追蹤執行緒狀態的工作函式
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::workerThreadFunc(int threadId)
+{
+    auto meta = getThreadMeta(threadId);
+    if (!meta) 
+    {
+        LOG_ERROR_T(threadId, "[Worker] Error: No ThreadMeta found");
+        return;
+    }
+
+    LOG_INFO_T(threadId, "[Worker] Thread started");
+
+    if (meta->cpu >= 0 || meta->numaNode >= 0)
+    {
+        WorkerPlacement where = resolvePlacement(placement_, static_cast<size_t>(threadId));
+        if (applyPlacement(where))
+            LOG_DEBUG_T(threadId, "[Worker] Pinned to cpu {} node {}", meta->cpu, meta->numaNode);
+    }
+
+    // 讓 Scheduler 知道目前執行緒身分（例如 WorkStealingScheduler 的本地 deque、NUMA node）
+    const Scheduler::WorkerInfo info{threadId, meta->cpu, meta->numaNode};
+    scheduler_->onWorkerStart(info);
+
+    const bool elastic = state_->poolmode == PoolMode::MODE_CACHED;
+    bool retired = false;
+
+    while (state_->isRunning)
+    {
+        // MODE_CACHED 以逾時等待，閒置過久的執行緒才有機會被回收（具體 SchedulerT 時為直接呼叫）
+        ConcurrentEngine::Scheduler::Task task = elastic
+            ? scheduler_->getTaskFor(state_->threadIdleTimeout)
+            : scheduler_->getTask();
+
+        if (!task)
+        {
+            if (!state_->isRunning) break;
+            if (elastic && tryRetire(*meta))
+            {
+                retired = true;
+                break;
+            }
+            continue;
+        }
+
+        const int64_t startNs = std::chrono::steady_clock::now().time_since_epoch().count();
+        if (task.enqueueTime() > 0)
+            meta->queueWait.record(static_cast<uint64_t>(std::max<int64_t>(0, startNs - task.enqueueTime())));
+
+        meta->markRunning();
+        state_->freeThread--;
+        LOG_INFO_T(threadId, "[Worker] Task started");
+
+        try 
+        {  task();  } 
+        catch (const std::exception& e) 
+        {
+            state_->failedCount++;
+            LOG_WARN_T(threadId, "[Worker] Task exception: {}", e.what());
+        }
+
+        const int64_t endNs = std::chrono::steady_clock::now().time_since_epoch().count();
+        meta->execTime.record(static_cast<uint64_t>(endNs - startNs));
+
+        LOG_INFO_T(threadId, "[Worker] Task finished");
+        state_->taskCount++;
+        state_->freeThread++;
+        meta->markIdle();
+    }
+
+    scheduler_->onWorkerStop(info);
+    state_->freeThread--;
+    if (!retired)
+        state_->curThreadCount--;   // 回收時已在 tryRetire 中遞減
+
+    meta->markTerminating();
+    LOG_INFO_T(threadId, retired ? "[Worker] Thread retired (idle)" : "[Worker] Thread exiting");
+
+    if (retired)
+    {
+        // 執行緒無法 join 自己，交給下一次擴充或 stop() 處理
+        std::lock_guard<std::mutex> lock(state_->threadMapMutex);
+        retiredQueueWait_.merge(meta->queueWait);
+        retiredExecTime_.merge(meta->execTime);
+        {
+            std::lock_guard<std::mutex> metaLock(meta->metaMutex);
+            retiredBusy_ += meta->busyTime;
+            retiredIdle_ += meta->idleTime;
+        }
+        threadMetas_.erase(threadId);
+        auto it = workers_.find(threadId);
+        if (it != workers_.end())
+        {
+            retired_.push_back(std::move(it->second));
+            workers_.erase(it);
+        }
+    }
+
+    meta->markTerminated();
+}
+
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::run(Scheduler::TaskGraph& graph)
+{
+    if (!scheduler_ || !state_ || !state_->isRunning)
+        throw std::runtime_error("[ThreadPool::run] Pool is not running");
+
+    graph.execute(this, &BasicThreadPool::dispatchGraphTasks, getCurThreadCount());
+}
+
+template<typename SchedulerT>
+typename BasicThreadPool<SchedulerT>::TimerId
+BasicThreadPool<SchedulerT>::scheduleTimer(std::chrono::steady_clock::time_point when, Scheduler::Task task,
+                                           std::chrono::nanoseconds period)
+{
+    if (!scheduler_ || !state_ || !state_->isRunning)
+    {
+        LOG_ERROR("[ThreadPool] Timer rejected: Not running.");
+        return TimingWheel::kInvalidTimer;
+    }
+    return timers_->schedule(when, std::move(task), period);
+}
+
+// TaskGraph 與時間輪的派送函式：跳過 submit 對 DAG Scheduler 的限制，直接交給 Scheduler
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::dispatchTasks(void* self, std::span<Scheduler::Task> tasks)
+{
+    auto* pool = static_cast<BasicThreadPool*>(self);
+
+    const int64_t enqueueNs = std::chrono::steady_clock::now().time_since_epoch().count();
+    for (Scheduler::Task& task : tasks)
+        task.setEnqueueTime(enqueueNs);
+
+    if constexpr (std::is_base_of_v<Scheduler::PriorityScheduler, SchedulerT>)
+        pool->scheduler_->addTasks(tasks, Scheduler::TaskPriority::MEDIUM);
+    else
+        pool->scheduler_->addTasks(tasks);
+
+    pool->state_->submitCount += tasks.size();
+
+    if (pool->state_->poolmode == PoolMode::MODE_CACHED)
+        pool->maybeScaleUp();
+}
+
+// TaskGraph 的派送函式：不套用 RejectPolicy，佇列放不下時停止，剩下的節點留在 span 中由 TaskGraph 就地執行
+// 工作執行緒派送後繼時不能依 BLOCK 等待，能消化佇列的可能只有它自己
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::dispatchGraphTasks(void* self, std::span<Scheduler::Task> tasks)
+{
+    auto* pool = static_cast<BasicThreadPool*>(self);
+
+    bool unbounded = false;
+    if constexpr (isPolymorphic)
+        unbounded = pool->kind_ == SchedulerKind::DAG;
+    else
+        unbounded = std::is_base_of_v<Scheduler::DAGScheduler, SchedulerT>;
+
+    if (unbounded)
+    {
+        dispatchTasks(pool, tasks);
+        return;
+    }
+    if (!pool->scheduler_ || !pool->state_->isRunning)
+        return;
+
+    const int64_t enqueueNs = std::chrono::steady_clock::now().time_since_epoch().count();
+    for (Scheduler::Task& task : tasks)
+        task.setEnqueueTime(enqueueNs);
+
+    const size_t accepted = pool->scheduler_->tryAddTasks(tasks);
+    if (accepted == 0)
+        return;
+
+    pool->state_->submitCount += accepted;
+    if (pool->state_->poolmode == PoolMode::MODE_CACHED)
+        pool->maybeScaleUp();
+}
+
+// Executor 的派送函式：接續經過目前的 Scheduler，DAG Scheduler 不接受普通提交，直接交給 Scheduler
+// pool 未執行或被拒絕時 task 在這裡被丟棄；接續與恢復任務在解構時會於當下的執行緒執行
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::postTask(void* self, Scheduler::Task task, uint8_t level)
+{
+    auto* pool = static_cast<BasicThreadPool*>(self);
+    if (!pool->scheduler_ || !pool->state_->isRunning)
+        return;
+
+    bool direct = false;
+    if constexpr (isPolymorphic)
+        direct = pool->kind_ == SchedulerKind::DAG;
+    else
+        direct = std::is_base_of_v<Scheduler::DAGScheduler, SchedulerT>;
+
+    try
+    {
+        if (direct)
+            dispatchTasks(pool, std::span<Scheduler::Task>(&task, 1));
+        else
+            pool->submit(std::move(task), Scheduler::Priority(level));
+    }
+    catch (const std::exception& e)
+    {
+        LOG_WARN("[ThreadPool] Continuation rejected: {}", e.what());
+    }
+}
+
+// 收集統計：計數器直接讀取，直方圖逐一合併各工作執行緒的複本（記錄端不需加鎖）
+template<typename SchedulerT>
+MetricsSnapshot BasicThreadPool<SchedulerT>::metricsSnapshot() const
+{
+    MetricsSnapshot snap;
+    snap.takenAt = std::chrono::steady_clock::now();
+    snap.threads = getCurThreadCount();
+    snap.freeThreads = getFreeThreadCount();
+    snap.queueSize = getQueueSize();
+    snap.submitted = state_->submitCount.load();
+    snap.completed = state_->taskCount.load();
+    snap.failed = state_->failedCount.load();
+
+    std::lock_guard<std::mutex> lock(state_->threadMapMutex);
+    snap.queueWait.merge(retiredQueueWait_);
+    snap.execTime.merge(retiredExecTime_);
+    snap.busy = retiredBusy_;
+    snap.idle = retiredIdle_;
+
+    snap.workers.reserve(threadMetas_.size());
+    for (const auto& [id, meta] : threadMetas_)
+    {
+        WorkerMetrics worker;
+        worker.id = id;
+        worker.cpu = meta->cpu;
+        worker.numaNode = meta->numaNode;
+        meta->activity(worker.state, worker.busy, worker.idle);
+
+        HistogramSnapshot exec;
+        exec.merge(meta->execTime);
+        worker.tasks = exec.count;
+
+        snap.queueWait.merge(meta->queueWait);
+        snap.execTime.merge(exec);
+        snap.busy += worker.busy;
+        snap.idle += worker.idle;
+        snap.workers.push_back(worker);
+    }
+
+    std::sort(snap.workers.begin(), snap.workers.end(),
+              [](const WorkerMetrics& a, const WorkerMetrics& b) { return a.id < b.id; });
+    return snap;
+}
+
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::reportStatus() const
+{
+    const MetricsSnapshot snap = metricsSnapshot();
+    auto us = [](uint64_t ns) { return static_cast<double>(ns) / 1e3; };
+
+    char line[160];
+    std::cout << "[ThreadPool Status]\n"
+              << " - Active Threads: " << snap.threads << "\n"
+              << " - Free Threads  : " << snap.freeThreads << "\n"
+              << " - Queue Size    : " << snap.queueSize << "\n"
+              << " - Tasks         : " << snap.submitted << " submitted, " << snap.completed << " completed, "
+              << snap.failed << " failed\n";
+
+    std::snprintf(line, sizeof(line), " - Queue Wait us : p50 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+                  us(snap.queueWait.percentile(0.5)), us(snap.queueWait.percentile(0.99)),
+                  us(snap.queueWait.percentile(0.999)), us(snap.queueWait.max));
+    std::cout << line;
+    std::snprintf(line, sizeof(line), " - Exec Time us  : p50 %.1f  p99 %.1f  p99.9 %.1f  max %.1f\n",
+                  us(snap.execTime.percentile(0.5)), us(snap.execTime.percentile(0.99)),
+                  us(snap.execTime.percentile(0.999)), us(snap.execTime.max));
+    std::cout << line;
+    std::snprintf(line, sizeof(line), " - Utilization   : %.1f%%\n", snap.utilization() * 100);
+    std::cout << line;
+
+    for (const auto& w : snap.workers)
+    {
+        std::snprintf(line, sizeof(line), "   * worker %d [%s] tasks %llu busy %.1f%%\n",
+                      w.id, toString(w.state), static_cast<unsigned long long>(w.tasks), w.utilization() * 100);
+        std::cout << line;
+    }
+}
+
+// 提交普通任務，使用預設優先級
+template<typename SchedulerT>
+void BasicThreadPool<SchedulerT>::submit(Scheduler::Task task)
+{  submit(std::move(task), Scheduler::TaskPriority::MEDIUM);  }
+
+// 提交普通任務，帶優先級的版本
+template<typename SchedulerT>
+bool BasicThreadPool<SchedulerT>::submit(Scheduler::Task task, Scheduler::Priority priority)
+{
+    if (!scheduler_) 
+    {
+        LOG_ERROR("[ThreadPool] Submit failed: No scheduler.");
+        return false;
+    }
+
+    if (!state_ || !state_->isRunning)
+    {
+        LOG_ERROR("[ThreadPool] Submit failed: Not running.");
+        return false;
+    }
+
+    LOG_INFO("[ThreadPool] Task submitted with priority {}", static_cast<int>(priority.level));
+
+    task.setEnqueueTime(std::chrono::steady_clock::now().time_since_epoch().count());
+
+    if constexpr (isPolymorphic)
+    {
+        switch (kind_)
+        {
+            case SchedulerKind::DAG:
+                // DAG 調度器不接受普通任務直接提交
+                LOG_ERROR("[ThreadPool] DAG Scheduler does not accept plain Task submit.");
+                return false;
+            case SchedulerKind::PRIORITY:
+                static_cast<Scheduler::PriorityScheduler*>(scheduler_.get())->addTask(std::move(task), priority);
+                break;
+            case SchedulerKind::EDF:
+            case SchedulerKind::GENERIC:
+                scheduler_->addTask(std::move(task));
+                break;
+        }
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::DAGScheduler, SchedulerT>)
+    {
+        LOG_ERROR("[ThreadPool] DAG Scheduler does not accept plain Task submit.");
+        return false;
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::PriorityScheduler, SchedulerT>)
+    {
+        scheduler_->addTask(std::move(task), priority);
+    }
+    else
+    {
+        scheduler_->addTask(std::move(task));
+    }
+
+    state_->submitCount++;
+
+    if (state_->poolmode == PoolMode::MODE_CACHED)
+        maybeScaleUp();
+
+    return true;
+}
+
+// 不阻塞的提交；熱路徑上不記錄 log，也不拋例外
+template<typename SchedulerT>
+Scheduler::SubmitStatus BasicThreadPool<SchedulerT>::trySubmit(Scheduler::Task& task, Scheduler::Priority priority)
+{
+    if (!scheduler_ || !state_ || !state_->isRunning)
+        return Scheduler::SubmitStatus::STOPPED;
+
+    task.setEnqueueTime(std::chrono::steady_clock::now().time_since_epoch().count());
+
+    Scheduler::SubmitStatus status = Scheduler::SubmitStatus::NOT_SUPPORTED;
+    if constexpr (isPolymorphic)
+    {
+        switch (kind_)
+        {
+            case SchedulerKind::DAG:
+                return Scheduler::SubmitStatus::NOT_SUPPORTED;
+            case SchedulerKind::PRIORITY:
+                status = static_cast<Scheduler::PriorityScheduler*>(scheduler_.get())->tryAddTask(task, priority);
+                break;
+            case SchedulerKind::EDF:
+            case SchedulerKind::GENERIC:
+                status = scheduler_->tryAddTask(task);
+                break;
+        }
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::DAGScheduler, SchedulerT>)
+    {
+        return Scheduler::SubmitStatus::NOT_SUPPORTED;
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::PriorityScheduler, SchedulerT>)
+    {
+        status = scheduler_->tryAddTask(task, priority);
+    }
+    else
+    {
+        status = scheduler_->tryAddTask(task);
+    }
+
+    if (status == Scheduler::SubmitStatus::ACCEPTED)
+    {
+        state_->submitCount++;
+        if (state_->poolmode == PoolMode::MODE_CACHED)
+            maybeScaleUp();
+    }
+    return status;
+}
+
+// 帶期限的提交；非 EDF 的 Scheduler 以一般提交處理（DAG 除外）
+template<typename SchedulerT>
+bool BasicThreadPool<SchedulerT>::submitWithDeadline(Scheduler::Task task, Scheduler::Deadline deadline)
+{
+    Scheduler::EDFScheduler* edf = nullptr;
+    if constexpr (isPolymorphic)
+    {
+        if (kind_ == SchedulerKind::EDF)
+            edf = static_cast<Scheduler::EDFScheduler*>(scheduler_.get());
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::EDFScheduler, SchedulerT>)
+    {
+        edf = scheduler_.get();
+    }
+
+    if (!edf)
+        return submit(std::move(task), Scheduler::TaskPriority::MEDIUM);
+
+    if (!state_ || !state_->isRunning)
+    {
+        LOG_ERROR("[ThreadPool] Submit failed: Not running.");
+        return false;
+    }
+
+    task.setEnqueueTime(std::chrono::steady_clock::now().time_since_epoch().count());
+    edf->addTask(std::move(task), deadline);
+    state_->submitCount++;
+
+    if (state_->poolmode == PoolMode::MODE_CACHED)
+        maybeScaleUp();
+
+    return true;
+}
+
+// 批次提交普通任務
+template<typename SchedulerT>
+bool BasicThreadPool<SchedulerT>::submitBatch(std::span<Scheduler::Task> tasks, Scheduler::Priority priority)
+{
+    if (!scheduler_ || !state_ || !state_->isRunning)
+    {
+        LOG_ERROR("[ThreadPool] Submit batch failed: No scheduler or not running.");
+        return false;
+    }
+
+    if (tasks.empty()) return true;
+
+    const int64_t enqueueNs = std::chrono::steady_clock::now().time_since_epoch().count();
+    for (Scheduler::Task& task : tasks)
+        task.setEnqueueTime(enqueueNs);
+
+    if constexpr (isPolymorphic)
+    {
+        switch (kind_)
+        {
+            case SchedulerKind::DAG:
+                LOG_ERROR("[ThreadPool] DAG Scheduler does not accept plain Task submit.");
+                return false;
+            case SchedulerKind::PRIORITY:
+                static_cast<Scheduler::PriorityScheduler*>(scheduler_.get())->addTasks(tasks, priority);
+                break;
+            case SchedulerKind::EDF:
+            case SchedulerKind::GENERIC:
+                scheduler_->addTasks(tasks);
+                break;
+        }
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::DAGScheduler, SchedulerT>)
+    {
+        LOG_ERROR("[ThreadPool] DAG Scheduler does not accept plain Task submit.");
+        return false;
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::PriorityScheduler, SchedulerT>)
+    {
+        scheduler_->addTasks(tasks, priority);
+    }
+    else
+    {
+        scheduler_->addTasks(tasks);
+    }
+
+    state_->submitCount += tasks.size();
+
+    if (state_->poolmode == PoolMode::MODE_CACHED)
+        maybeScaleUp();
+
+    return true;
+}
+
+// 專用 DAG 任務提交（包含依賴）
+template<typename SchedulerT>
+bool BasicThreadPool<SchedulerT>::submitDAG(std::shared_ptr<Scheduler::TaskNode> node,
+                   const std::vector<std::shared_ptr<Scheduler::TaskNode>>& deps,
+                   Scheduler::DAGHandle group)
+{
+    if (!scheduler_ || !state_ || !state_->isRunning) return false;
+
+    Scheduler::DAGScheduler* dag = nullptr;
+    if constexpr (isPolymorphic)
+    {
+        if (kind_ == SchedulerKind::DAG)
+            dag = static_cast<Scheduler::DAGScheduler*>(scheduler_.get());
+    }
+    else if constexpr (std::is_base_of_v<Scheduler::DAGScheduler, SchedulerT>)
+    {
+        dag = scheduler_.get();
+    }
+    LOG_INFO("==== submitDAG ====");
+
+    if (!dag) 
+    {
+        LOG_ERROR("[ThreadPool] Current scheduler is not DAG.");
+        return false;
+    }
+
+    if (!node || !node->task) 
+    {
+        LOG_ERROR("[ThreadPool] ERROR: submitDAG received invalid task.");
+        return false;
+    }
+
+    if (!dag->addTask(node, deps, std::move(group)))
+        return false;
+
+    LOG_INFO("[ThreadPool] DAG task submitted.");
+    return true;
+}
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_BASICTHREADPOOL_HPP
@@ -0,0 +1,170 @@
+#ifndef CONCURRENTENGINE_CORE_CANCELLATION_HPP
+#define CONCURRENTENGINE_CORE_CANCELLATION_HPP
+
+#include <threadPool/core/recyclingAllocator.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ConcurrentEngine
+{
+
+// 任務在開始執行前就被取消，回傳 future 的提交會收到這個例外
+class TaskCancelled : public std::runtime_error
+{
+public:
+    TaskCancelled() : std::runtime_error("[ThreadPool] Task cancelled before it started") {}
+};
+
+// 協作式取消旗標：可複製，所有複本共用同一個狀態，同一個 token 可交給任意多個任務
+// - 尚在佇列中的任務被取出時直接放棄，不佔用工作執行緒的執行時間
+// - 執行中的任務以 cancellationRequested()（或自行持有的 token）輪詢後自行結束
+// - 狀態以侵入式計數管理（只佔一個指標），讓包裝後的任務仍能放進 TaskFunction 的內部緩衝區
+class CancellationToken
+{
+public:
+    CancellationToken() : state_(create()) {}
+
+    // 不可取消的空 token
+    explicit CancellationToken(std::nullptr_t) noexcept {}
+
+    CancellationToken(const CancellationToken& other) noexcept : state_(other.state_) {  retain();  }
+    CancellationToken(CancellationToken&& other) noexcept : state_(std::exchange(other.state_, nullptr)) {}
+
+    CancellationToken& operator=(CancellationToken other) noexcept
+    {
+        std::swap(state_, other.state_);
+        return *this;
+    }
+
+    ~CancellationToken() {  release();  }
+
+    // 第一次要求取消時回傳 true
+    bool cancel() noexcept
+    {  return state_ && !state_->cancelled.exchange(true, std::memory_order_acq_rel);  }
+
+    bool isCancelled() const noexcept
+    {  return state_ && state_->cancelled.load(std::memory_order_acquire);  }
+
+    bool cancellable() const noexcept {  return state_ != nullptr;  }
+
+private:
+    struct alignas(void*) State
+    {
+        std::atomic<bool> cancelled{false};
+        std::atomic<uint32_t> refs{1};
+    };
+
+    static State* create()
+    {
+        State* state = RecyclingAllocator<State>{}.allocate(1);
+        return ::new (state) State{};
+    }
+
+    void retain() noexcept
+    {
+        if (state_)
+            state_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void release() noexcept
+    {
+        if (state_ && state_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            state_->~State();
+            RecyclingAllocator<State>{}.deallocate(state_, 1);
+        }
+    }
+
+    State* state_ = nullptr;
+};
+
+namespace detail
+{
+inline thread_local const CancellationToken* currentToken = nullptr;
+} // namespace detail
+
+// 目前執行緒上正在執行的任務是否已被要求取消；任務沒有綁定 token 時為 false
+inline bool cancellationRequested() noexcept
+{  return detail::currentToken && detail::currentToken->isCancelled();  }
+
+// 執行任務期間設定目前的 token；巢狀執行（呼叫端順便執行其他任務）結束時還原
+class CancellationScope
+{
+public:
+    explicit CancellationScope(const CancellationToken& token) noexcept
+        : previous_(std::exchange(detail::currentToken, &token)) {}
+    ~CancellationScope() {  detail::currentToken = previous_;  }
+
+    CancellationScope(const CancellationScope&) = delete;
+    CancellationScope& operator=(const CancellationScope&) = delete;
+
+private:
+    const CancellationToken* previous_;
+};
+
+// 包裝一個任務：取出時 token 已取消就不執行，改以 TaskCancelled 放棄（future 收到例外）
+template<typename Inner>
+struct CancellableTask
+{
+    CancellationToken token;
+    Inner inner;
+
+    void operator()()
+    {
+        if (token.isCancelled())
+        {
+            fail(std::make_exception_ptr(TaskCancelled{}));
+            return;
+        }
+
+        CancellationScope scope(token);
+        inner();
+    }
+
+    void fail(std::exception_ptr error)
+    {
+        if constexpr (requires { inner.fail(std::move(error)); })
+            inner.fail(std::move(error));
+    }
+};
+
+// submit(token, ...) 的回傳值：future 加上取消用的 token
+// cancel() 取消的是 token，共用同一個 token 的其他任務也一併取消
+template<typename R>
+class TaskHandle
+{
+public:
+    TaskHandle() = default;
+    TaskHandle(std::future<R> future, CancellationToken token)
+        : future_(std::move(future)), token_(std::move(token)) {}
+
+    bool cancel() noexcept {  return token_.cancel();  }
+    bool isCancelled() const noexcept {  return token_.isCancelled();  }
+    const CancellationToken& token() const noexcept {  return token_;  }
+
+    // 取消後尚未開始的任務會拋出 TaskCancelled
+    R get() {  return future_.get();  }
+    void wait() const {  future_.wait();  }
+    bool valid() const noexcept {  return future_.valid();  }
+
+    template<typename Rep, typename Period>
+    std::future_status wait_for(const std::chrono::duration<Rep, Period>& timeout) const
+    {  return future_.wait_for(timeout);  }
+
+    std::future<R>& future() noexcept {  return future_;  }
+
+private:
+    std::future<R> future_;
+    CancellationToken token_{nullptr};
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_CANCELLATION_HPP
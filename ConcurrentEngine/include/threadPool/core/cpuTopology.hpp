@@ -0,0 +1,69 @@
+#ifndef CONCURRENTENGINE_CORE_CPUTOPOLOGY_HPP
+#define CONCURRENTENGINE_CORE_CPUTOPOLOGY_HPP
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace ConcurrentEngine
+{
+
+// 從 /sys/devices/system 讀取的 CPU / NUMA 拓樸（只讀取一次）
+// 讀不到時（非 Linux 或容器限制）視為單一 node，包含 hardware_concurrency 個 CPU
+class CpuTopology
+{
+public:
+    static const CpuTopology& get();
+
+    const std::vector<int>& cpus() const { return cpus_; }                 // 可用的 CPU，依編號排序
+    const std::vector<int>& cpusOfNode(int node) const;                    // 該 node 上可用的 CPU
+    int nodeOfCpu(int cpu) const;                                          // 未知時回傳 0
+    size_t nodeCount() const { return nodeCpus_.size(); }
+
+private:
+    CpuTopology();
+
+    std::vector<int> cpus_;
+    std::vector<std::vector<int>> nodeCpus_;
+    std::vector<int> cpuNode_;   // 以 CPU 編號索引
+};
+
+// 工作執行緒的放置策略，由 ThreadPool::start 套用
+// - NONE        ：不綁定
+// - COMPACT     ：依 node 順序把執行緒依序綁在相鄰 CPU，填滿一個 node 再換下一個
+// - SCATTER     ：輪流分散到各 node，node 內再依序挑 CPU
+// - EXPLICIT    ：第 i 條執行緒綁在 cpus[i % cpus.size()]
+// - PER_NUMA_NODE：第 i 條執行緒綁在 node (i % nodeCount) 的整組 CPU，允許在 node 內遷移
+struct PlacementPolicy
+{
+    enum class Kind { NONE, COMPACT, SCATTER, EXPLICIT, PER_NUMA_NODE };
+
+    Kind kind = Kind::NONE;
+    std::vector<int> cpus;
+
+    static PlacementPolicy none() { return {}; }
+    static PlacementPolicy compact() { return {Kind::COMPACT, {}}; }
+    static PlacementPolicy scatter() { return {Kind::SCATTER, {}}; }
+    static PlacementPolicy perNumaNode() { return {Kind::PER_NUMA_NODE, {}}; }
+    static PlacementPolicy explicitCpus(std::vector<int> list) { return {Kind::EXPLICIT, std::move(list)}; }
+};
+
+// 依策略決定第 index 條執行緒的位置；cpu 為 -1 代表綁在整個 node（或不綁定）
+struct WorkerPlacement
+{
+    std::vector<int> cpuSet;   // 空代表不綁定
+    int cpu = -1;
+    int numaNode = -1;
+};
+
+WorkerPlacement resolvePlacement(const PlacementPolicy& policy, size_t index);
+
+// 將目前執行緒綁定到 placement.cpuSet，並記錄所在 node；失敗時回傳 false（執行緒仍可正常運作）
+bool applyPlacement(const WorkerPlacement& placement);
+
+// 目前執行緒所在的 NUMA node：已綁定的工作執行緒回傳綁定的 node，其他執行緒依 sched_getcpu 判斷
+int currentNumaNode();
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_CPUTOPOLOGY_HPP
@@ -0,0 +1,75 @@
+#ifndef CONCURRENTENGINE_CORE_EVENTCOUNT_HPP
+#define CONCURRENTENGINE_CORE_EVENTCOUNT_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace ConcurrentEngine
+{
+
+// Event count：讓「檢查條件 → 休眠」不需要與生產者共用一把鎖
+// 等待端：key = prepareWait() → 再檢查一次條件 → 成立則 cancelWait()，否則 wait(key)
+// 通知端：先發布資料再 notify()；沒有任何等待者時只是一次原子讀取，不進入核心
+// Linux 上以 futex 休眠 / 喚醒 epoch，其他平台以 std::atomic::wait 代替
+class EventCount
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    class Key
+    {
+        friend class EventCount;
+        explicit Key(uint32_t epoch) : epoch_(epoch) {}
+        uint32_t epoch_;
+    };
+
+    EventCount() = default;
+    EventCount(const EventCount&) = delete;
+    EventCount& operator=(const EventCount&) = delete;
+
+    Key prepareWait() noexcept
+    {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        // 與 notify() 的 fence 配對：之後的條件檢查一定看得到通知前發布的資料
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        return Key(epoch_.load(std::memory_order_acquire));
+    }
+
+    void cancelWait() noexcept
+    {  waiters_.fetch_sub(1, std::memory_order_seq_cst);  }
+
+    // 等到 prepareWait() 之後有人 notify
+    void wait(Key key) noexcept;
+
+    // 逾時回傳 false；兩種情況都會取消登記
+    bool waitUntil(Key key, Clock::time_point deadline) noexcept;
+
+    // 喚醒至多 count 個等待者
+    void notify(size_t count = 1) noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) return;
+        wake(count);
+    }
+
+    void notifyAll() noexcept
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waiters_.load(std::memory_order_relaxed) == 0) return;
+        wake(SIZE_MAX);
+    }
+
+    size_t waiters() const noexcept {  return waiters_.load(std::memory_order_relaxed);  }
+
+private:
+    void wake(size_t count) noexcept;
+
+    std::atomic<uint32_t> epoch_{0};     // futex 字組
+    std::atomic<uint32_t> waiters_{0};   // 已登記（含尚未真正休眠）的等待者
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_EVENTCOUNT_HPP
@@ -0,0 +1,503 @@
+#ifndef CONCURRENTENGINE_CORE_FUTURE_HPP
+#define CONCURRENTENGINE_CORE_FUTURE_HPP
+
+#include <threadPool/core/taskFunction.hpp>
+#include <threadPool/core/recyclingAllocator.hpp>
+#include <threadPool/core/promiseTask.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace ConcurrentEngine
+{
+
+// 接續的派送目標：ThreadPool 以 executor(priority) 提供，交給目前的 Scheduler（優先級照常生效）
+// post 一定會取走 task；交不出去時 task 會被丟棄，因此交出的接續須以 Continuation 包裝
+struct Executor
+{
+    using Post = void (*)(void* ctx, TaskFunction task, uint8_t level);
+
+    void* ctx = nullptr;
+    Post post = nullptr;
+    uint8_t level = 128;
+
+    // 沒有派送目標時在目前的執行緒直接執行
+    void execute(TaskFunction task) const
+    {
+        if (post)
+            post(ctx, std::move(task), level);
+        else
+            task();
+    }
+};
+
+namespace detail
+{
+
+// 一定會執行一次的接續：被 Scheduler 執行、放棄（fail）或沒有執行就解構時，都在當下的執行緒執行 fn
+// 用於結果已就緒後的喚醒，避免被拒絕的接續讓等待的一方永遠停住
+template<typename Fn>
+class Continuation
+{
+public:
+    explicit Continuation(Fn fn) : fn_(std::move(fn)) {}
+    Continuation(Continuation&& other) noexcept(std::is_nothrow_move_constructible_v<Fn>)
+        : fn_(std::move(other.fn_)), pending_(std::exchange(other.pending_, false)) {}
+    Continuation& operator=(Continuation&&) = delete;
+
+    ~Continuation()
+    {
+        if (pending_)
+            fn_();
+    }
+
+    void operator()()
+    {
+        pending_ = false;
+        fn_();
+    }
+
+private:
+    Fn fn_;
+    bool pending_ = true;
+};
+
+// 恢復一個等待中的協程
+struct ResumeCoroutine
+{
+    std::coroutine_handle<> handle;
+
+    void operator()() const {  handle.resume();  }
+};
+
+// Future 的共享狀態：結果只設定一次，接續只有一個
+template<typename T>
+class FutureState
+{
+public:
+    using Value = std::conditional_t<std::is_void_v<T>, std::monostate, T>;
+
+    explicit FutureState(Executor executor) : executor_(executor) {}
+
+    template<typename... U>
+    void setValue(U&&... value)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (ready_) return;
+        value_.emplace(std::forward<U>(value)...);
+        complete(lock);
+    }
+
+    void setException(std::exception_ptr error)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (ready_) return;
+        error_ = std::move(error);
+        complete(lock);
+    }
+
+    bool ready() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ready_;
+    }
+
+    // 尚未完成時登記接續並回傳 true；已完成時回傳 false，fn 不會被取走
+    // 接續在完成時交給 Executor；inlineRun 為 true 時直接在完成的執行緒執行（只用於 when_all / when_any 的簿記）
+    template<typename Fn>
+    bool attach(Fn&& fn, bool inlineRun = false)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ready_) return false;
+        continuation_ = Continuation<std::decay_t<Fn>>(std::forward<Fn>(fn));
+        inlineContinuation_ = inlineRun;
+        return true;
+    }
+
+    void wait() const
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return ready_; });
+    }
+
+    // 須在完成後呼叫，只能取一次
+    T take()
+    {
+        if (error_)
+            std::rethrow_exception(error_);
+        if constexpr (!std::is_void_v<T>)
+            return std::move(*value_);
+    }
+
+    const Executor& executor() const {  return executor_;  }
+
+private:
+    void complete(std::unique_lock<std::mutex>& lock)
+    {
+        ready_ = true;
+        TaskFunction continuation = std::move(continuation_);
+        lock.unlock();
+        cv_.notify_all();
+
+        if (!continuation) return;
+        if (inlineContinuation_)
+            continuation();
+        else
+            executor_.execute(std::move(continuation));
+    }
+
+    mutable std::mutex mutex_;
+    mutable std::condition_variable cv_;
+    bool ready_ = false;
+    bool inlineContinuation_ = false;
+    std::optional<Value> value_;
+    std::exception_ptr error_;
+    TaskFunction continuation_;
+    const Executor executor_;
+};
+
+template<typename T>
+std::shared_ptr<FutureState<T>> makeFutureState(Executor executor)
+{  return std::allocate_shared<FutureState<T>>(RecyclingAllocator<FutureState<T>>{}, executor);  }
+
+// 以 fn(args...) 的結果（或例外）完成 target
+template<typename R, typename Fn, typename... Args>
+void completeWith(FutureState<R>& target, Fn& fn, Args&&... args)
+{
+    try
+    {
+        if constexpr (std::is_void_v<R>)
+        {
+            std::invoke(fn, std::forward<Args>(args)...);
+            target.setValue();
+        }
+        else
+        {
+            target.setValue(std::invoke(fn, std::forward<Args>(args)...));
+        }
+    }
+    catch (...)
+    {  target.setException(std::current_exception());  }
+}
+
+template<typename T, typename Fn>
+struct ThenResult {  using type = std::invoke_result_t<Fn&, T>;  };
+
+template<typename Fn>
+struct ThenResult<void, Fn> {  using type = std::invoke_result_t<Fn&>;  };
+
+struct FutureAccess;
+
+} // namespace detail
+
+// ThreadPool 的非阻塞 future：可在協程中 co_await，或以 then() 接上後續工作，等待期間不佔用任何執行緒
+// - 結果就緒時，等待的協程或 then() 的接續經由建立時的 Executor 交回 Scheduler（優先級照常生效）
+// - get() / wait() 會阻塞，只應在 pool 之外（例如 main）使用
+// - 與 std::future 相同，結果只能取一次；then() 與 co_await 也會取走結果
+template<typename T>
+class Future
+{
+public:
+    using value_type = T;
+    using State = detail::FutureState<T>;
+
+    Future() = default;
+    explicit Future(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+    bool valid() const noexcept {  return state_ != nullptr;  }
+    bool isReady() const {  return state_ && state_->ready();  }
+
+    // 接續派送的目標
+    const Executor& executor() const {  return state_->executor();  }
+
+    void wait() const {  state_->wait();  }
+
+    T get()
+    {
+        auto state = std::move(state_);
+        state->wait();
+        return state->take();
+    }
+
+    struct Awaiter
+    {
+        std::shared_ptr<State> state;
+
+        bool await_ready() const {  return state->ready();  }
+
+        // 登記失敗表示剛好完成，直接繼續
+        bool await_suspend(std::coroutine_handle<> handle)
+        {  return state->attach(detail::ResumeCoroutine{handle});  }
+
+        T await_resume() {  return state->take();  }
+    };
+
+    Awaiter operator co_await() && noexcept {  return Awaiter{std::move(state_)};  }
+
+    // 結果就緒後在 pool 上執行 fn(value)（T 為 void 時為 fn()），回傳 fn 結果的 Future
+    // 這個 Future 以例外完成時不呼叫 fn，例外直接傳給回傳的 Future；呼叫後 valid() 為 false
+    template<typename Fn>
+    auto then(Fn&& fn) -> Future<typename detail::ThenResult<T, std::decay_t<Fn>>::type>
+    {
+        using R = typename detail::ThenResult<T, std::decay_t<Fn>>::type;
+
+        auto source = std::move(state_);
+        auto next = detail::makeFutureState<R>(source->executor());
+
+        auto run = [source, next, fn = std::forward<Fn>(fn)]() mutable {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    source->take();
+                    detail::completeWith(*next, fn);
+                }
+                else
+                {
+                    detail::completeWith(*next, fn, source->take());
+                }
+            }
+            catch (...)
+            {  next->setException(std::current_exception());  }
+        };
+
+        // 已經完成時直接交給 Executor
+        if (!source->attach(std::move(run)))
+            source->executor().execute(detail::Continuation<decltype(run)>(std::move(run)));
+
+        return Future<R>(std::move(next));
+    }
+
+private:
+    friend struct detail::FutureAccess;
+
+    std::shared_ptr<State> state_;
+};
+
+namespace detail
+{
+
+struct FutureAccess
+{
+    template<typename T>
+    static std::shared_ptr<FutureState<T>> release(Future<T>& future) {  return std::move(future.state_);  }
+};
+
+template<typename T>
+using StoredValue = typename FutureState<T>::Value;
+
+// when_all / when_any 的輸入須全部有效（尚未被 get / then / co_await 取走）
+template<typename T>
+void requireValid(const std::vector<Future<T>>& futures, const char* message)
+{
+    for (const auto& future : futures)
+    {
+        if (!future.valid())
+            throw std::invalid_argument(message);
+    }
+}
+
+} // namespace detail
+
+// when_all 的結果：vector<T>；T 為 void 時為 void
+template<typename T>
+using WhenAllResult = std::conditional_t<std::is_void_v<T>, void, std::vector<T>>;
+
+// when_any 的結果：{索引, 值}；T 為 void 時只有索引
+template<typename T>
+using WhenAnyResult = std::conditional_t<std::is_void_v<T>, size_t, std::pair<size_t, detail::StoredValue<T>>>;
+
+// 全部完成後完成；任一個以例外完成時，回傳的 Future 立即帶著第一個例外完成
+// 簿記在完成輸入的執行緒上直接進行，只有回傳 Future 的接續會交給 Scheduler
+// 沒有輸入時回傳已完成的 Future；輸入中有無效的 Future 時拋出 std::invalid_argument
+template<typename T>
+Future<WhenAllResult<T>> when_all(std::vector<Future<T>> futures)
+{
+    using Result = WhenAllResult<T>;
+
+    detail::requireValid(futures, "[when_all] Invalid future in input");
+    if (futures.empty())
+    {
+        auto ready = detail::makeFutureState<Result>(Executor{});
+        ready->setValue();
+        return Future<Result>(std::move(ready));
+    }
+
+    auto result = detail::makeFutureState<Result>(futures.front().executor());
+
+    struct Gather
+    {
+        std::vector<std::optional<detail::StoredValue<T>>> values;
+        std::atomic<size_t> remaining;
+        std::atomic<bool> failed{false};
+        std::shared_ptr<detail::FutureState<Result>> result;
+
+        Gather(size_t count, std::shared_ptr<detail::FutureState<Result>> r)
+            : values(count), remaining(count), result(std::move(r)) {}
+    };
+    auto gather = std::make_shared<Gather>(futures.size(), result);
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        auto source = detail::FutureAccess::release(futures[i]);
+        auto collect = [gather, source, i]() {
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                    source->take();
+                else
+                    gather->values[i].emplace(source->take());
+            }
+            catch (...)
+            {
+                if (!gather->failed.exchange(true, std::memory_order_acq_rel))
+                    gather->result->setException(std::current_exception());
+            }
+
+            // 最後一個完成的一方組出結果；各自寫入的 values[i] 由 acq_rel 的遞減交給它
+            if (gather->remaining.fetch_sub(1, std::memory_order_acq_rel) != 1 ||
+                gather->failed.load(std::memory_order_relaxed))
+                return;
+
+            if constexpr (std::is_void_v<T>)
+            {
+                gather->result->setValue();
+            }
+            else
+            {
+                std::vector<T> values;
+                values.reserve(gather->values.size());
+                for (auto& value : gather->values)
+                    values.push_back(std::move(*value));
+                gather->result->setValue(std::move(values));
+            }
+        };
+
+        if (!source->attach(std::move(collect), true))
+            collect();
+    }
+
+    return Future<Result>(std::move(result));
+}
+
+// 第一個成功完成的結果；全部都以例外完成時，帶著最後一個例外完成
+// 沒有輸入或輸入中有無效的 Future 時拋出 std::invalid_argument
+template<typename T>
+Future<WhenAnyResult<T>> when_any(std::vector<Future<T>> futures)
+{
+    using Result = WhenAnyResult<T>;
+
+    if (futures.empty())
+        throw std::invalid_argument("[when_any] No futures");
+    detail::requireValid(futures, "[when_any] Invalid future in input");
+
+    auto result = detail::makeFutureState<Result>(futures.front().executor());
+
+    struct Race
+    {
+        std::atomic<size_t> remaining;
+        std::atomic<bool> won{false};
+        std::shared_ptr<detail::FutureState<Result>> result;
+
+        Race(size_t count, std::shared_ptr<detail::FutureState<Result>> r) : remaining(count), result(std::move(r)) {}
+    };
+    auto race = std::make_shared<Race>(futures.size(), result);
+
+    for (size_t i = 0; i < futures.size(); ++i)
+    {
+        auto source = detail::FutureAccess::release(futures[i]);
+        auto collect = [race, source, i]() {
+            std::exception_ptr error;
+            try
+            {
+                if constexpr (std::is_void_v<T>)
+                {
+                    source->take();
+                    if (!race->won.exchange(true, std::memory_order_acq_rel))
+                        race->result->setValue(i);
+                }
+                else
+                {
+                    auto value = source->take();
+                    if (!race->won.exchange(true, std::memory_order_acq_rel))
+                        race->result->setValue(Result(i, std::move(value)));
+                }
+            }
+            catch (...)
+            {  error = std::current_exception();  }
+
+            if (race->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1 && error &&
+                !race->won.load(std::memory_order_acquire))
+                race->result->setException(error);
+        };
+
+        if (!source->attach(std::move(collect), true))
+            collect();
+    }
+
+    return Future<Result>(std::move(result));
+}
+
+// 在 Scheduler 上執行並把結果寫入 Future；被 Scheduler 放棄時 Future 收到錯誤
+template<typename R, typename Func, typename... Args>
+struct FutureTask
+{
+    std::shared_ptr<detail::FutureState<R>> state;
+    Func func;
+    std::tuple<Args...> args;
+
+    void operator()()
+    {
+        try
+        {
+            if constexpr (std::is_void_v<R>)
+            {
+                std::apply(func, args);
+                state->setValue();
+            }
+            else
+            {
+                state->setValue(std::apply(func, args));
+            }
+        }
+        catch (...)
+        {  state->setException(std::current_exception());  }
+    }
+
+    void fail(std::exception_ptr error)
+    {  state->setException(std::move(error));  }
+};
+
+// 建立 {任務, Future}；接續經由 executor 派送
+template<typename Func, typename... Args>
+auto makeFutureTask(Executor executor, Func&& f, Args&&... args)
+{
+    using R = BoundResult<Func, Args...>;
+    using TaskType = FutureTask<R, std::decay_t<Func>, std::decay_t<Args>...>;
+
+    auto state = detail::makeFutureState<R>(executor);
+    Future<R> future(state);
+
+    TaskType task{std::move(state),
+                  std::forward<Func>(f),
+                  std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...)};
+
+    return std::pair<TaskType, Future<R>>(std::move(task), std::move(future));
+}
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_FUTURE_HPP
@@ -0,0 +1,114 @@
+#ifndef CONCURRENTENGINE_CORE_LATENCYHISTOGRAM_HPP
+#define CONCURRENTENGINE_CORE_LATENCYHISTOGRAM_HPP
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ConcurrentEngine
+{
+
+// HDR 風格的對數-線性直方圖（單位：奈秒）
+// 每個 2 的冪次區間再切成 kSubBuckets 格，相對誤差約 1/kSubBuckets（約 3%）
+// 只允許一個執行緒寫入（工作執行緒各自一份），其他執行緒可隨時以 snapshot() 讀取
+class LatencyHistogram
+{
+public:
+    static constexpr int kSubBucketBits = 5;
+    static constexpr uint64_t kSubBuckets = uint64_t{1} << kSubBucketBits;
+    static constexpr int kMaxBits = 48;   // 超過約 78 小時的值併入最後一格
+    static constexpr uint64_t kMaxValue = (uint64_t{1} << kMaxBits) - 1;
+    static constexpr size_t kBucketCount =
+        static_cast<size_t>((kMaxBits - kSubBucketBits) * kSubBuckets + kSubBuckets);
+
+    static size_t indexOf(uint64_t value)
+    {
+        value = std::min(value, kMaxValue);
+        const int msb = std::bit_width(value) - 1;
+        const int shift = std::max(0, msb - kSubBucketBits);
+        return static_cast<size_t>(shift) * kSubBuckets + static_cast<size_t>(value >> shift);
+    }
+
+    // 該格涵蓋的最大值，作為百分位數的代表值
+    static uint64_t valueAt(size_t index)
+    {
+        if (index < 2 * kSubBuckets) return index;
+        const uint64_t shift = index / kSubBuckets - 1;
+        const uint64_t sub = index - shift * kSubBuckets;
+        return ((sub + 1) << shift) - 1;
+    }
+
+    // 單一寫入者：以 load + store 取代 fetch_add，讀取端看到的是某個時間點附近的一致近似值
+    void record(uint64_t value)
+    {
+        bump(counts_[indexOf(value)], 1);
+        bump(count_, 1);
+        bump(sum_, value);
+        if (value > max_.load(std::memory_order_relaxed))
+            max_.store(value, std::memory_order_relaxed);
+    }
+
+    friend struct HistogramSnapshot;
+
+private:
+    static void bump(std::atomic<uint64_t>& counter, uint64_t delta)
+    {  counter.store(counter.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);  }
+
+    std::array<std::atomic<uint64_t>, kBucketCount> counts_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+// 直方圖在某個時間點的複本，可合併多個工作執行緒的結果
+struct HistogramSnapshot
+{
+    std::vector<uint64_t> counts = std::vector<uint64_t>(LatencyHistogram::kBucketCount, 0);
+    uint64_t count = 0;
+    uint64_t sum = 0;
+    uint64_t max = 0;
+
+    void merge(const LatencyHistogram& hist)
+    {
+        for (size_t i = 0; i < counts.size(); ++i)
+            counts[i] += hist.counts_[i].load(std::memory_order_relaxed);
+        count += hist.count_.load(std::memory_order_relaxed);
+        sum += hist.sum_.load(std::memory_order_relaxed);
+        max = std::max(max, hist.max_.load(std::memory_order_relaxed));
+    }
+
+    void merge(const HistogramSnapshot& other)
+    {
+        for (size_t i = 0; i < counts.size(); ++i)
+            counts[i] += other.counts[i];
+        count += other.count;
+        sum += other.sum;
+        max = std::max(max, other.max);
+    }
+
+    double mean() const { return count ? static_cast<double>(sum) / static_cast<double>(count) : 0.0; }
+
+    // q 介於 0 與 1，例如 0.99；沒有資料時回傳 0
+    uint64_t percentile(double q) const
+    {
+        if (count == 0) return 0;
+
+        const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(q * static_cast<double>(count) + 0.5));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts.size(); ++i)
+        {
+            seen += counts[i];
+            if (seen >= target)
+                return std::min(LatencyHistogram::valueAt(i), max);
+        }
+        return max;
+    }
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_LATENCYHISTOGRAM_HPP
@@ -0,0 +1,128 @@
+#ifndef CONCURRENTENGINE_CORE_MPMCRINGBUFFER_HPP
+#define CONCURRENTENGINE_CORE_MPMCRINGBUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace ConcurrentEngine
+{
+
+// 固定容量的無鎖 MPMC 環形佇列（Vyukov bounded queue）
+// 每個 slot 帶序號：sequence == pos 表示可寫入，sequence == pos + 1 表示可讀取
+// 容量至少為 2：只有一個 slot 時「已寫入」與「下一輪可寫入」的序號相同，生產者會覆蓋尚未取出的值
+template<typename T>
+class MPMCRingBuffer
+{
+public:
+    explicit MPMCRingBuffer(size_t capacity)
+        : capacity_(capacity < 2 ? 2 : capacity)
+        , mask_((capacity_ & (capacity_ - 1)) == 0 ? capacity_ - 1 : 0)
+        , usesMask_((capacity_ & (capacity_ - 1)) == 0)
+        , cells_(new Cell[capacity_])
+    {
+        for (size_t i = 0; i < capacity_; ++i)
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MPMCRingBuffer(const MPMCRingBuffer&) = delete;
+    MPMCRingBuffer& operator=(const MPMCRingBuffer&) = delete;
+
+    // 成功時才會移動 item；佇列滿時回傳 false，item 保持不變
+    bool tryPush(T& item)
+    {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true)
+        {
+            cell = &cells_[index(pos)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0)
+            {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false;  // 滿
+            }
+            else
+            {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(item);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 佇列空（或生產者尚未寫完）時回傳 false
+    bool tryPop(T& out)
+    {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        Cell* cell;
+
+        while (true)
+        {
+            cell = &cells_[index(pos)];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+
+            if (diff == 0)
+            {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else if (diff < 0)
+            {
+                return false;  // 空
+            }
+            else
+            {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+
+        out = std::move(cell->value);
+        cell->value = T{};
+        cell->sequence.store(pos + capacity_, std::memory_order_release);
+        return true;
+    }
+
+    // 近似值：包含已保留但尚未寫完的 slot
+    size_t sizeApprox() const
+    {
+        size_t tail = enqueuePos_.load(std::memory_order_seq_cst);
+        size_t head = dequeuePos_.load(std::memory_order_seq_cst);
+        return tail > head ? tail - head : 0;
+    }
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value{};
+    };
+
+    size_t index(size_t pos) const
+    {  return usesMask_ ? (pos & mask_) : (pos % capacity_);  }
+
+    const size_t capacity_;
+    const size_t mask_;
+    const bool usesMask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_MPMCRINGBUFFER_HPP
@@ -0,0 +1,59 @@
+#ifndef CONCURRENTENGINE_CORE_POOLMETRICS_HPP
+#define CONCURRENTENGINE_CORE_POOLMETRICS_HPP
+
+#include <threadPool/core/latencyHistogram.hpp>
+#include <threadPool/core/threadMeta.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace ConcurrentEngine
+{
+
+// 單一工作執行緒的統計
+struct WorkerMetrics
+{
+    int id = -1;
+    int cpu = -1;
+    int numaNode = -1;
+    ThreadState state = ThreadState::Idle;
+    uint64_t tasks = 0;
+    std::chrono::steady_clock::duration busy{0};
+    std::chrono::steady_clock::duration idle{0};
+
+    // 忙碌時間佔比，0 ~ 1
+    double utilization() const
+    {
+        auto total = busy + idle;
+        return total.count() > 0 ? static_cast<double>(busy.count()) / static_cast<double>(total.count()) : 0.0;
+    }
+};
+
+// ThreadPool::metricsSnapshot() 的結果，各欄位分別讀取，彼此之間不保證同一瞬間
+// queueWait：提交到開始執行；execTime：任務本身的執行時間（皆為奈秒）
+// 已回收執行緒的直方圖與忙碌 / 閒置時間併入整體統計，但不出現在 workers 中
+struct MetricsSnapshot
+{
+    std::chrono::steady_clock::time_point takenAt;
+    size_t threads = 0;
+    size_t freeThreads = 0;
+    size_t queueSize = 0;
+    uint64_t submitted = 0;   // 由 ThreadPool 交給 Scheduler 的任務數（含被 DISCARD / DROP_OLDEST 放棄與 CALLER_RUNS 由提交者執行的）
+    uint64_t completed = 0;
+    uint64_t failed = 0;      // 執行時拋出例外的 Task 數（回傳 future 的提交由 future 接收例外，不計入）
+    HistogramSnapshot queueWait;
+    HistogramSnapshot execTime;
+    std::chrono::steady_clock::duration busy{0};
+    std::chrono::steady_clock::duration idle{0};
+    std::vector<WorkerMetrics> workers;
+
+    double utilization() const
+    {
+        auto total = busy + idle;
+        return total.count() > 0 ? static_cast<double>(busy.count()) / static_cast<double>(total.count()) : 0.0;
+    }
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_POOLMETRICS_HPP
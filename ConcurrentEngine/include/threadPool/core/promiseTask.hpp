@@ -0,0 +1,69 @@
+#ifndef CONCURRENTENGINE_CORE_PROMISETASK_HPP
+#define CONCURRENTENGINE_CORE_PROMISETASK_HPP
+
+#include <threadPool/core/recyclingAllocator.hpp>
+#include <functional>
+#include <future>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace ConcurrentEngine
+{
+
+// 與 std::bind 相同的語意：引數以 decay 後的左值傳入
+template<typename Func, typename... Args>
+using BoundResult = std::invoke_result_t<std::decay_t<Func>&, std::decay_t<Args>&...>;
+
+// 取代 shared_ptr<packaged_task>：promise 與呼叫物件一起放進 TaskFunction 的內部緩衝區
+template<typename R, typename Func, typename... Args>
+struct PromiseTask
+{
+    std::promise<R> promise;
+    Func func;
+    std::tuple<Args...> args;
+
+    void operator()()
+    {
+        try
+        {
+            if constexpr (std::is_void_v<R>)
+            {
+                std::apply(func, args);
+                promise.set_value();
+            }
+            else
+            {
+                promise.set_value(std::apply(func, args));
+            }
+        }
+        catch (...)
+        {  promise.set_exception(std::current_exception());  }
+    }
+
+    // 不執行而放棄時（TaskFunction::fail），future 收到 error
+    void fail(std::exception_ptr error)
+    {  promise.set_exception(std::move(error));  }
+};
+
+// 建立 promise（共享狀態由 RecyclingAllocator 配置）並回傳 {任務, future}
+template<typename Func, typename... Args>
+auto makePromiseTask(Func&& f, Args&&... args)
+{
+    using R = BoundResult<Func, Args...>;
+    using TaskType = PromiseTask<R, std::decay_t<Func>, std::decay_t<Args>...>;
+
+    std::promise<R> promise(std::allocator_arg, RecyclingAllocator<char>{});
+    std::future<R> future = promise.get_future();
+
+    TaskType task{std::move(promise),
+                  std::forward<Func>(f),
+                  std::tuple<std::decay_t<Args>...>(std::forward<Args>(args)...)};
+
+    return std::pair<TaskType, std::future<R>>(std::move(task), std::move(future));
+}
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_PROMISETASK_HPP
@@ -0,0 +1,99 @@
+#ifndef CONCURRENTENGINE_CORE_RECYCLINGALLOCATOR_HPP
+#define CONCURRENTENGINE_CORE_RECYCLINGALLOCATOR_HPP
+
+#include <cstddef>
+#include <memory>
+
+namespace ConcurrentEngine
+{
+
+// 以 thread_local free list 回收固定大小區塊的 allocator
+// 用於 std::promise / std::allocate_shared 的共享狀態，穩定狀態下提交任務不需 malloc
+// 區塊可以在任意執行緒釋放，會進入該執行緒的 free list
+template<typename T>
+class RecyclingAllocator
+{
+public:
+    using value_type = T;
+
+    static constexpr size_t kMaxCached = 1024;
+
+    RecyclingAllocator() noexcept = default;
+
+    template<typename U>
+    RecyclingAllocator(const RecyclingAllocator<U>&) noexcept {}
+
+    T* allocate(size_t n)
+    {
+        if (n == 1 && canCache && !tornDown)
+        {
+            FreeList& list = freeList();
+            if (list.head)
+            {
+                Node* node = list.head;
+                list.head = node->next;
+                --list.count;
+                return reinterpret_cast<T*>(node);
+            }
+        }
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate(T* p, size_t n) noexcept
+    {
+        if (n == 1 && canCache && !tornDown)
+        {
+            FreeList& list = freeList();
+            if (list.count < kMaxCached)
+            {
+                Node* node = reinterpret_cast<Node*>(p);
+                node->next = list.head;
+                list.head = node;
+                ++list.count;
+                return;
+            }
+        }
+        std::allocator<T>{}.deallocate(p, n);
+    }
+
+    template<typename U>
+    bool operator==(const RecyclingAllocator<U>&) const noexcept { return true; }
+
+    template<typename U>
+    bool operator!=(const RecyclingAllocator<U>&) const noexcept { return false; }
+
+private:
+    struct Node { Node* next; };
+
+    static constexpr bool canCache = sizeof(T) >= sizeof(Node) && alignof(T) >= alignof(Node);
+
+    struct FreeList
+    {
+        Node* head = nullptr;
+        size_t count = 0;
+
+        ~FreeList()
+        {
+            // 執行緒結束後，其他 thread_local 解構時的釋放改走一般 allocator
+            tornDown = true;
+            while (head)
+            {
+                Node* next = head->next;
+                std::allocator<T>{}.deallocate(reinterpret_cast<T*>(head), 1);
+                head = next;
+            }
+        }
+    };
+
+    static FreeList& freeList()
+    {
+        thread_local FreeList list;
+        return list;
+    }
+
+    static inline thread_local bool tornDown = false;
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_RECYCLINGALLOCATOR_HPP
@@ -0,0 +1,115 @@
+#ifndef CONCURRENTENGINE_CORE_RINGQUEUE_HPP
+#define CONCURRENTENGINE_CORE_RINGQUEUE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace ConcurrentEngine
+{
+
+// 環形緩衝區實作的 FIFO 佇列（介面同 std::queue 的子集，非執行緒安全）
+// 與 std::deque 不同，取出元素後不會釋放區塊，容量只增不減，穩定狀態下 push/pop 不配置記憶體
+template<typename T>
+class RingQueue
+{
+public:
+    RingQueue() = default;
+
+    RingQueue(RingQueue&& other) noexcept
+        : buffer_(std::exchange(other.buffer_, nullptr))
+        , capacity_(std::exchange(other.capacity_, 0))
+        , head_(std::exchange(other.head_, 0))
+        , count_(std::exchange(other.count_, 0))
+    {}
+
+    RingQueue& operator=(RingQueue&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            buffer_ = std::exchange(other.buffer_, nullptr);
+            capacity_ = std::exchange(other.capacity_, 0);
+            head_ = std::exchange(other.head_, 0);
+            count_ = std::exchange(other.count_, 0);
+        }
+        return *this;
+    }
+
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+
+    ~RingQueue() { release(); }
+
+    void push(T&& value)
+    {
+        if (count_ == capacity_)
+            grow();
+        ::new (static_cast<void*>(slot(count_))) T(std::move(value));
+        ++count_;
+    }
+
+    void push(const T& value)
+    {
+        T copy(value);
+        push(std::move(copy));
+    }
+
+    T& front() { return *slot(0); }
+    const T& front() const { return *const_cast<RingQueue*>(this)->slot(0); }
+
+    void pop()
+    {
+        slot(0)->~T();
+        head_ = (head_ + 1) & (capacity_ - 1);
+        --count_;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+private:
+    T* slot(size_t offset)
+    {  return std::launder(reinterpret_cast<T*>(buffer_) + ((head_ + offset) & (capacity_ - 1)));  }
+
+    void grow()
+    {
+        size_t newCapacity = capacity_ == 0 ? 16 : capacity_ * 2;
+        auto* newBuffer = static_cast<unsigned char*>(::operator new(newCapacity * sizeof(T), std::align_val_t(alignof(T))));
+
+        for (size_t i = 0; i < count_; ++i)
+        {
+            T* src = slot(i);
+            ::new (static_cast<void*>(reinterpret_cast<T*>(newBuffer) + i)) T(std::move(*src));
+            src->~T();
+        }
+
+        if (buffer_)
+            ::operator delete(buffer_, std::align_val_t(alignof(T)));
+
+        buffer_ = newBuffer;
+        capacity_ = newCapacity;
+        head_ = 0;
+    }
+
+    void release()
+    {
+        while (count_ > 0)
+            pop();
+        if (buffer_)
+            ::operator delete(buffer_, std::align_val_t(alignof(T)));
+        buffer_ = nullptr;
+        capacity_ = 0;
+        head_ = 0;
+    }
+
+    unsigned char* buffer_ = nullptr;
+    size_t capacity_ = 0;
+    size_t head_ = 0;
+    size_t count_ = 0;
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_RINGQUEUE_HPP
@@ -0,0 +1,193 @@
+#ifndef CONCURRENTENGINE_CORE_TASKFUNCTION_HPP
+#define CONCURRENTENGINE_CORE_TASKFUNCTION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace ConcurrentEngine
+{
+
+// 只能移動的 void() 呼叫物件，取代 std::function<void()>
+// - 小於 kInlineSize 的閉包直接放在內部緩衝區，不配置記憶體
+// - 不要求可複製，因此可以直接持有 std::promise 等只能移動的物件
+// - 附帶提交時間戳（ThreadPool 用來統計排隊時間），整體維持 64 bytes
+// - 呼叫物件若提供 fail(std::exception_ptr)，Scheduler 可用 fail() 放棄任務並把錯誤交給它
+class TaskFunction
+{
+public:
+    static constexpr size_t kInlineSize = 48;
+
+    TaskFunction() noexcept = default;
+    TaskFunction(std::nullptr_t) noexcept {}
+
+    template<typename F,
+             typename Fn = std::decay_t<F>,
+             typename = std::enable_if_t<!std::is_same_v<Fn, TaskFunction> &&
+                                         std::is_invocable_v<Fn&>>>
+    TaskFunction(F&& f)
+    {
+        if constexpr (std::is_pointer_v<Fn> || isStdFunction<Fn>::value)
+        {
+            // 空的函式指標 / std::function 視為空任務
+            if (!f) return;
+        }
+
+        if constexpr (fitsInline<Fn>)
+        {
+            ::new (static_cast<void*>(storage_)) Fn(std::forward<F>(f));
+            vtable_ = &InlineOps<Fn>::table;
+        }
+        else
+        {
+            *reinterpret_cast<Fn**>(storage_) = new Fn(std::forward<F>(f));
+            vtable_ = &HeapOps<Fn>::table;
+        }
+    }
+
+    TaskFunction(TaskFunction&& other) noexcept
+    {  moveFrom(other);  }
+
+    TaskFunction& operator=(TaskFunction&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    TaskFunction& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    TaskFunction(const TaskFunction&) = delete;
+    TaskFunction& operator=(const TaskFunction&) = delete;
+
+    ~TaskFunction() { reset(); }
+
+    void operator()()
+    {
+        if (!vtable_) throw std::bad_function_call();
+        vtable_->invoke(storage_);
+    }
+
+    explicit operator bool() const noexcept { return vtable_ != nullptr; }
+
+    // 不執行而放棄任務（例如已超過期限）：回傳 future 的提交會收到 error，之後任務為空
+    void fail(std::exception_ptr error) noexcept
+    {
+        if (!vtable_) return;
+        if (vtable_->fail)
+            vtable_->fail(storage_, std::move(error));
+        reset();
+    }
+
+    // 提交時間（steady_clock 奈秒），0 代表未標記
+    void setEnqueueTime(int64_t ns) noexcept { enqueueNs_ = ns; }
+    int64_t enqueueTime() const noexcept { return enqueueNs_; }
+
+private:
+    struct VTable
+    {
+        void (*invoke)(void*);
+        void (*move)(void* dst, void* src) noexcept;
+        void (*destroy)(void*) noexcept;
+        void (*fail)(void*, std::exception_ptr) noexcept;   // 呼叫物件沒有 fail() 時為空
+    };
+
+    template<typename Fn>
+    static constexpr bool hasFail = requires(Fn& fn, std::exception_ptr error) { fn.fail(error); };
+
+    template<typename Fn>
+    struct isStdFunction : std::false_type {};
+
+    template<typename Sig>
+    struct isStdFunction<std::function<Sig>> : std::true_type {};
+
+    template<typename Fn>
+    static constexpr bool fitsInline = sizeof(Fn) <= kInlineSize &&
+                                       alignof(Fn) <= alignof(std::max_align_t) &&
+                                       std::is_nothrow_move_constructible_v<Fn>;
+
+    template<typename Fn>
+    struct InlineOps
+    {
+        static Fn* get(void* p) { return std::launder(static_cast<Fn*>(p)); }
+
+        static void invoke(void* p) { (*get(p))(); }
+        static void move(void* dst, void* src) noexcept
+        {
+            ::new (dst) Fn(std::move(*get(src)));
+            get(src)->~Fn();
+        }
+        static void destroy(void* p) noexcept { get(p)->~Fn(); }
+
+        // fail() 拋出的例外一律忽略（例如 promise 已經有值）
+        static void fail(void* p, std::exception_ptr error) noexcept
+        {
+            if constexpr (hasFail<Fn>)
+            {
+                try {  get(p)->fail(std::move(error));  } catch (...) {}
+            }
+        }
+
+        static constexpr VTable table{&invoke, &move, &destroy, hasFail<Fn> ? &fail : nullptr};
+    };
+
+    template<typename Fn>
+    struct HeapOps
+    {
+        static Fn*& get(void* p) { return *static_cast<Fn**>(p); }
+
+        static void invoke(void* p) { (*get(p))(); }
+        static void move(void* dst, void* src) noexcept
+        {
+            *static_cast<Fn**>(dst) = get(src);
+            get(src) = nullptr;
+        }
+        static void destroy(void* p) noexcept { delete get(p); }
+
+        static void fail(void* p, std::exception_ptr error) noexcept
+        {
+            if constexpr (hasFail<Fn>)
+            {
+                try {  get(p)->fail(std::move(error));  } catch (...) {}
+            }
+        }
+
+        static constexpr VTable table{&invoke, &move, &destroy, hasFail<Fn> ? &fail : nullptr};
+    };
+
+    void moveFrom(TaskFunction& other) noexcept
+    {
+        if (!other.vtable_) return;
+        other.vtable_->move(storage_, other.storage_);
+        vtable_ = other.vtable_;
+        other.vtable_ = nullptr;
+        enqueueNs_ = other.enqueueNs_;
+    }
+
+    void reset() noexcept
+    {
+        if (!vtable_) return;
+        vtable_->destroy(storage_);
+        vtable_ = nullptr;
+        enqueueNs_ = 0;
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+    const VTable* vtable_ = nullptr;
+    int64_t enqueueNs_ = 0;
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_TASKFUNCTION_HPP
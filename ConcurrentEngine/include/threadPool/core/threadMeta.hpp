@@ -6,6 +6,7 @@
 #include <mutex>
 #include <threadPool/logger/threadLogger.hpp>
 #include <threadPool/core/thread.hpp>
+#include <threadPool/core/latencyHistogram.hpp>
 
 class Thread;
 
@@ -30,32 +31,53 @@ inline const char* toString(ThreadState state)
 
 struct ThreadMeta 
 {
-    ThreadMeta(int id) : id(id), thread(nullptr)
+    ThreadMeta(int id)
+        : id(id)
+        , thread(nullptr)
+        , state(ThreadState::Idle)
+        , lastActiveTime(std::chrono::steady_clock::now())
+        , stateSince(lastActiveTime)
     {
-        ThreadLogger::getInstance().log("[ThreadMeta] Created with ID = " + std::to_string(id), LogLevel::INFO, id);
+        LOG_INFO_T(id, "[ThreadMeta] Created with ID = {}", id);
     }
 
     ThreadMeta(int id, std::unique_ptr<Thread> thread)
         : id(id)
         , thread(std::move(thread))
-        , lastActiveTime(std::chrono::steady_clock::now())
         , state(ThreadState::Idle)
+        , lastActiveTime(std::chrono::steady_clock::now())
+        , stateSince(lastActiveTime)
     {
-        ThreadLogger::getInstance().log("[ThreadMeta] Initialized with thread. State = Idle", LogLevel::INFO, id);
+        LOG_INFO_T(id, "[ThreadMeta] Initialized with thread. State = Idle");
     }
 
     int id;
+    int cpu = -1;        // 綁定的 CPU，-1 代表未綁定到單一 CPU
+    int numaNode = -1;   // 所在 NUMA node，-1 代表未綁定
     std::unique_ptr<Thread> thread;
     ThreadState state;
     mutable std::mutex metaMutex;
     std::chrono::steady_clock::time_point lastActiveTime;
 
+    // 由 Idle / Running 轉換累計的忙碌與閒置時間（受 metaMutex 保護，不含目前這一段）
+    std::chrono::steady_clock::time_point stateSince;
+    std::chrono::steady_clock::duration busyTime{0};
+    std::chrono::steady_clock::duration idleTime{0};
+
+    // 只由該工作執行緒寫入
+    ConcurrentEngine::LatencyHistogram queueWait;
+    ConcurrentEngine::LatencyHistogram execTime;
+
     void markIdle() 
     {
         std::lock_guard<std::mutex> lock(metaMutex);
+        auto now = std::chrono::steady_clock::now();
+        if (state == ThreadState::Running)
+            busyTime += now - stateSince;
+        stateSince = now;
         state = ThreadState::Idle;
-        lastActiveTime = std::chrono::steady_clock::now();
-        ThreadLogger::getInstance().log("[ThreadMeta] Marked Idle", LogLevel::INFO, id);
+        lastActiveTime = now;
+        LOG_INFO_T(id, "[ThreadMeta] Marked Idle");
     }
 
     bool isIdle() const 
@@ -67,36 +89,61 @@ struct ThreadMeta
     void markRunning() 
     {
         std::lock_guard<std::mutex> lock(metaMutex);
+        auto now = std::chrono::steady_clock::now();
+        if (state == ThreadState::Idle)
+            idleTime += now - stateSince;
+        stateSince = now;
         state = ThreadState::Running;
-        ThreadLogger::getInstance().log("[ThreadMeta] Marked Running", LogLevel::INFO, id);
+        LOG_INFO_T(id, "[ThreadMeta] Marked Running");
     }
 
-    bool shouldRecycle(std::chrono::seconds timeout) const
+    bool shouldRecycle(std::chrono::steady_clock::duration timeout) const
     {
         std::lock_guard<std::mutex> lock(metaMutex);
         return state == ThreadState::Idle &&
                (std::chrono::steady_clock::now() - lastActiveTime) > timeout;
     }
 
+    // 忙碌 / 閒置時間，包含目前正在進行的這一段
+    void activity(ThreadState& current,
+                  std::chrono::steady_clock::duration& busy,
+                  std::chrono::steady_clock::duration& idle) const
+    {
+        std::lock_guard<std::mutex> lock(metaMutex);
+        current = state;
+        busy = busyTime;
+        idle = idleTime;
+
+        auto open = std::chrono::steady_clock::now() - stateSince;
+        if (state == ThreadState::Running)   busy += open;
+        else if (state == ThreadState::Idle) idle += open;
+    }
+
     void markTerminating() 
     {
         std::lock_guard<std::mutex> lock(metaMutex);
+        auto now = std::chrono::steady_clock::now();
+        if (state == ThreadState::Running)
+            busyTime += now - stateSince;
+        else if (state == ThreadState::Idle)
+            idleTime += now - stateSince;
+        stateSince = now;
         state= ThreadState::Terminating;
-        ThreadLogger::getInstance().log("[ThreadMeta] Marked Terminating", LogLevel::INFO, id);
+        LOG_INFO_T(id, "[ThreadMeta] Marked Terminating");
     }
 
     void markTerminated() 
     {
         std::lock_guard<std::mutex> lock(metaMutex);
         state= ThreadState::Terminated;
-        ThreadLogger::getInstance().log("[ThreadMeta] Marked Terminated", LogLevel::INFO, id);
+        LOG_INFO_T(id, "[ThreadMeta] Marked Terminated");
     }
 
     void join() 
     {
         if (thread && thread->joinable())
         {
-            ThreadLogger::getInstance().log("[ThreadMeta] Joining thread", LogLevel::INFO, id);
+            LOG_INFO_T(id, "[ThreadMeta] Joining thread");
             thread->join();
         }
     }
@@ -0,0 +1,135 @@
+#ifndef CONCURRENTENGINE_CORE_TIMINGWHEEL_HPP
+#define CONCURRENTENGINE_CORE_TIMINGWHEEL_HPP
+
+#include <threadPool/core/taskFunction.hpp>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace ConcurrentEngine
+{
+
+// 階層式時間輪：4 層 × 256 格，第 k 層每格為 256^k 個 tick（預設 1ms，約可涵蓋 49 天，更遠的會在最上層重複輪轉）
+// - 加入與取消皆為 O(1)：節點放在 slab 中，以雙向鏈結串在格子上，TimerId 帶世代編號避免誤取消
+// - 一條計時執行緒在第一次加入計時器時啟動，只在下一個非空的格子或需要下放（cascade）時醒來，
+//   到期的任務整批交給 dispatch（ThreadPool 交給目前的 Scheduler），不佔用工作執行緒
+// - 週期任務為固定速率；上一次尚未執行完時跳過這一次，不會重疊或堆積
+class TimingWheel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+    using Dispatch = void (*)(void* ctx, std::span<TaskFunction> tasks);
+
+    static constexpr TimerId kInvalidTimer = 0;
+
+    // dispatch 在計時執行緒上呼叫；交不出去（仍留在 span 中）的任務會以錯誤放棄
+    TimingWheel(void* ctx, Dispatch dispatch, std::chrono::nanoseconds tick = std::chrono::milliseconds(1));
+    ~TimingWheel();
+
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+
+    // period 為 0 時只執行一次；when 已過去時在下一個 tick 執行
+    TimerId schedule(Clock::time_point when, TaskFunction task, std::chrono::nanoseconds period = {});
+
+    // 尚未到期（或為週期任務）時移除並回傳 true；已交出的那一次不受影響
+    bool cancel(TimerId id);
+
+    // 停止計時執行緒，尚未到期的任務以錯誤放棄；之後再 schedule() 會重新啟動
+    void stop();
+
+    size_t size() const;
+    std::chrono::nanoseconds tick() const { return std::chrono::nanoseconds(tickNs_); }
+
+private:
+    static constexpr int kLevels = 4;
+    static constexpr int kSlotBits = 8;
+    static constexpr size_t kSlots = size_t{1} << kSlotBits;
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    // 週期任務的本體由每一次交出的任務共用
+    struct Periodic
+    {
+        TaskFunction body;
+        std::atomic<bool> running{false};
+    };
+
+    // 交給 Scheduler 的一次執行；物件解構（執行完或被丟棄）時才允許下一次
+    struct PeriodicRun
+    {
+        std::shared_ptr<Periodic> periodic;
+
+        explicit PeriodicRun(std::shared_ptr<Periodic> p) : periodic(std::move(p)) {}
+        PeriodicRun(PeriodicRun&&) noexcept = default;
+        ~PeriodicRun()
+        {
+            if (periodic)
+                periodic->running.store(false, std::memory_order_release);
+        }
+
+        void operator()() {  periodic->body();  }
+    };
+
+    struct Node
+    {
+        TaskFunction task;                   // 單次任務
+        std::shared_ptr<Periodic> periodic;  // 週期任務
+        int64_t expiry = 0;                  // 到期的 tick
+        int64_t period = 0;                  // 週期（tick），0 為單次
+        uint32_t prev = kNil;
+        uint32_t next = kNil;
+        uint32_t generation = 1;
+        uint16_t slot = 0;
+        uint8_t level = 0;
+        bool linked = false;
+    };
+
+    void run();
+    int64_t tickAt(Clock::time_point time) const;   // 無條件捨去
+    Clock::time_point timeOf(int64_t tick) const;
+
+    uint32_t allocNode();
+    void freeNode(uint32_t index);
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    void advanceTo(int64_t tick);
+    void cascade(int level);
+    void expire(uint32_t index);
+    int64_t nextWakeTick() const;
+    void failAll(std::vector<TaskFunction>& tasks, const char* reason);
+
+    void* ctx_;
+    Dispatch dispatch_;
+    const int64_t tickNs_;
+    const Clock::time_point epoch_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+    bool running_ = false;
+
+    std::vector<Node> nodes_;
+    uint32_t freeHead_ = kNil;
+    std::array<std::array<uint32_t, kSlots>, kLevels> slots_;
+    std::array<uint64_t, kSlots / 64> level0Bits_{};   // 第 0 層非空格子的位元圖
+    std::array<size_t, kLevels> levelCount_{};
+    size_t count_ = 0;
+    int64_t currentTick_ = 0;    // 已處理到的 tick
+    int64_t wakeTick_ = 0;       // 計時執行緒預計醒來的 tick
+
+    std::vector<TaskFunction> due_;           // 受 mutex_ 保護
+    std::vector<TaskFunction> dispatching_;   // 只由計時執行緒使用
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_TIMINGWHEEL_HPP
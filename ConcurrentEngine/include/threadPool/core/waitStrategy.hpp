@@ -0,0 +1,108 @@
+#ifndef CONCURRENTENGINE_CORE_WAITSTRATEGY_HPP
+#define CONCURRENTENGINE_CORE_WAITSTRATEGY_HPP
+
+#include <threadPool/core/eventCount.hpp>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace ConcurrentEngine
+{
+
+// 自旋等待時降低耗電與對 sibling hyper-thread 的干擾
+inline void cpuRelax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+// 工作執行緒閒置時的等待方式：先自旋 spins 次（pause），再 yield yields 次，最後才休眠
+// 自旋越久，任務到來時的喚醒延遲越低，但閒置時也越耗 CPU
+struct WaitStrategy
+{
+    uint32_t spins = 0;
+    uint32_t yields = 0;
+
+    // 直接休眠：閒置時幾乎不耗 CPU，適合與其他程式共用機器
+    static constexpr WaitStrategy blocking() noexcept {  return {0, 0};  }
+
+    // 預設：短暫自旋吸收突發的任務，約數微秒後休眠
+    static constexpr WaitStrategy balanced() noexcept {  return {128, 4};  }
+
+    // 長時間自旋：延遲敏感且有專屬核心時使用
+    static constexpr WaitStrategy lowLatency() noexcept {  return {16384, 64};  }
+};
+
+// Scheduler 用的閒置等待：spin → yield → 在 EventCount 上休眠
+// - hasWork()：不取鎖的快速檢查（可以不精確），只在自旋階段用來決定何時再嘗試
+// - tryTake()：真正取出任務；取到任務或 Scheduler 已停止時回傳 true
+// 生產者放入任務後呼叫 notify()，沒有執行緒休眠時不會進入核心
+class IdleWaiter
+{
+public:
+    using Clock = EventCount::Clock;
+
+    // 須在工作執行緒開始等待前設定
+    void setStrategy(const WaitStrategy& strategy) noexcept {  strategy_ = strategy;  }
+    const WaitStrategy& strategy() const noexcept {  return strategy_;  }
+
+    template<typename HasWork, typename TryTake>
+    bool wait(HasWork&& hasWork, TryTake&& tryTake)
+    {  return waitUntil(hasWork, tryTake, Clock::time_point::max());  }
+
+    // 逾時回傳 false
+    template<typename HasWork, typename TryTake>
+    bool waitUntil(HasWork&& hasWork, TryTake&& tryTake, Clock::time_point deadline)
+    {
+        const bool timed = deadline != Clock::time_point::max();
+
+        while (true)
+        {
+            if (tryTake()) return true;
+
+            bool maybeReady = false;
+            for (uint32_t i = 0; i < strategy_.spins && !maybeReady; ++i)
+            {
+                cpuRelax();
+                maybeReady = hasWork();
+            }
+            for (uint32_t i = 0; i < strategy_.yields && !maybeReady; ++i)
+            {
+                std::this_thread::yield();
+                maybeReady = hasWork();
+            }
+            if (maybeReady) continue;
+
+            // 先登記再檢查一次，登記之後的 notify 一定會喚醒這次等待
+            auto key = event_.prepareWait();
+            if (tryTake())
+            {
+                event_.cancelWait();
+                return true;
+            }
+
+            if (!timed)
+                event_.wait(key);
+            else if (!event_.waitUntil(key, deadline))
+                return tryTake();
+        }
+    }
+
+    void notify(size_t count = 1) noexcept {  event_.notify(count);  }
+    void notifyAll() noexcept {  event_.notifyAll();  }
+
+private:
+    WaitStrategy strategy_ = WaitStrategy::balanced();
+    EventCount event_;
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_WAITSTRATEGY_HPP
@@ -0,0 +1,141 @@
+#ifndef CONCURRENTENGINE_CORE_WORKSTEALINGDEQUE_HPP
+#define CONCURRENTENGINE_CORE_WORKSTEALINGDEQUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <type_traits>
+
+namespace ConcurrentEngine
+{
+
+// Chase-Lev 工作竊取雙端佇列（Lê et al. 2013 的弱記憶體模型版本）
+// - push / pop 只能由擁有者執行緒呼叫（底端，LIFO）
+// - steal 可由任意執行緒呼叫（頂端，FIFO）
+// T 必須可被 std::atomic 包裝（通常是指標）
+template<typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque element must be trivially copyable");
+
+public:
+    explicit WorkStealingDeque(int64_t capacity = 256)
+    {
+        int64_t cap = 1;
+        while (cap < capacity) cap <<= 1;
+
+        garbage_.push_back(std::make_unique<Array>(cap));
+        array_.store(garbage_.back().get(), std::memory_order_relaxed);
+    }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    void push(T item)
+    {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        Array* a = array_.load(std::memory_order_relaxed);
+
+        if (b - t > a->capacity - 1)
+            a = grow(a, b, t);
+
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+
+    std::optional<T> pop()
+    {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* a = array_.load(std::memory_order_relaxed);
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+
+        if (t > b)
+        {
+            // 佇列為空，還原 bottom
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        T item = a->get(b);
+        if (t == b)
+        {
+            // 只剩最後一個元素，與竊取者競爭
+            bool won = top_.compare_exchange_strong(t, t + 1,
+                                                    std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            if (!won) return std::nullopt;
+        }
+        return item;
+    }
+
+    std::optional<T> steal()
+    {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+
+        if (t >= b) return std::nullopt;
+
+        Array* a = array_.load(std::memory_order_acquire);
+        T item = a->get(t);
+        if (!top_.compare_exchange_strong(t, t + 1,
+                                          std::memory_order_seq_cst,
+                                          std::memory_order_relaxed))
+            return std::nullopt;
+
+        return item;
+    }
+
+    // 近似值，僅供統計
+    size_t size() const
+    {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        return b > t ? static_cast<size_t>(b - t) : 0;
+    }
+
+    bool empty() const { return size() == 0; }
+
+private:
+    struct Array
+    {
+        explicit Array(int64_t cap)
+            : capacity(cap), mask(cap - 1), slots(new std::atomic<T>[cap]) {}
+
+        T get(int64_t i) const { return slots[i & mask].load(std::memory_order_relaxed); }
+        void put(int64_t i, T item) { slots[i & mask].store(item, std::memory_order_relaxed); }
+
+        int64_t capacity;
+        int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    // 容量不足時加倍；舊陣列保留到解構，竊取者可能仍在讀取
+    Array* grow(Array* old, int64_t b, int64_t t)
+    {
+        auto bigger = std::make_unique<Array>(old->capacity * 2);
+        for (int64_t i = t; i < b; ++i)
+            bigger->put(i, old->get(i));
+
+        Array* raw = bigger.get();
+        garbage_.push_back(std::move(bigger));
+        array_.store(raw, std::memory_order_release);
+        return raw;
+    }
+
+    alignas(64) std::atomic<int64_t> top_{0};
+    alignas(64) std::atomic<int64_t> bottom_{0};
+    alignas(64) std::atomic<Array*> array_{nullptr};
+    std::vector<std::unique_ptr<Array>> garbage_;  // 只有擁有者會修改
+};
+
+} // namespace ConcurrentEngine
+
+#endif // CONCURRENTENGINE_CORE_WORKSTEALINGDEQUE_HPP
@@ -0,0 +1,214 @@
+#ifndef CONCURRENTENGINE_COROUTINE_COROTASK_HPP
+#define CONCURRENTENGINE_COROUTINE_COROTASK_HPP
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+// 與 Scheduler::Task（TaskFunction）區分，協程型別放在 Coro 命名空間
+namespace ConcurrentEngine::Coro
+{
+
+template<typename T = void>
+class Task;
+
+namespace detail
+{
+
+struct PromiseBase
+{
+    std::coroutine_handle<> continuation = std::noop_coroutine();
+    std::exception_ptr error;
+
+    // 結束時以對稱轉移直接恢復等待者，不經過 Scheduler、也不會加深堆疊
+    struct FinalAwaiter
+    {
+        bool await_ready() const noexcept {  return false;  }
+
+        template<typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {  return handle.promise().continuation;  }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept {  return {};  }
+    FinalAwaiter final_suspend() const noexcept {  return {};  }
+    void unhandled_exception() noexcept {  error = std::current_exception();  }
+};
+
+template<typename T>
+struct Promise : PromiseBase
+{
+    std::optional<T> value;
+
+    Task<T> get_return_object() noexcept;
+
+    template<typename U>
+        requires std::is_convertible_v<U&&, T>
+    void return_value(U&& result) {  value.emplace(std::forward<U>(result));  }
+
+    T result()
+    {
+        if (error)
+            std::rethrow_exception(error);
+        return std::move(*value);
+    }
+};
+
+template<>
+struct Promise<void> : PromiseBase
+{
+    Task<void> get_return_object() noexcept;
+
+    void return_void() noexcept {}
+
+    void result()
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+};
+
+// 不需要結果的協程：立即開始，結束時自行釋放
+struct Detached
+{
+    struct promise_type
+    {
+        Detached get_return_object() noexcept {  return {};  }
+        std::suspend_never initial_suspend() const noexcept {  return {};  }
+        std::suspend_never final_suspend() const noexcept {  return {};  }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept {  std::terminate();  }
+    };
+};
+
+} // namespace detail
+
+// 惰性的協程任務：建立時不執行，被 co_await 時才在等待者所在的執行緒開始
+// - 子任務結束時直接恢復等待者（對稱轉移）；要切換到工作執行緒請 co_await pool.schedule()
+// - 例外會在 co_await 處重新拋出
+// - 交給 pool.spawn() 在工作執行緒上開始並取得 Future；在 pool 之外可用 syncWait() 等待
+template<typename T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = detail::Promise<T>;
+    using value_type = T;
+
+    Task() noexcept = default;
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task& operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_) handle_.destroy();
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Task()
+    {
+        if (handle_) handle_.destroy();
+    }
+
+    bool valid() const noexcept {  return static_cast<bool>(handle_);  }
+    bool done() const noexcept {  return handle_ && handle_.done();  }
+
+    struct Awaiter
+    {
+        std::coroutine_handle<promise_type> handle;
+
+        bool await_ready() const noexcept {  return handle.done();  }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+
+        T await_resume() {  return handle.promise().result();  }
+    };
+
+    Awaiter operator co_await() && noexcept {  return Awaiter{handle_};  }
+
+private:
+    friend struct detail::Promise<T>;
+
+    explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_(handle) {}
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail
+{
+
+template<typename T>
+Task<T> Promise<T>::get_return_object() noexcept
+{  return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));  }
+
+inline Task<void> Promise<void>::get_return_object() noexcept
+{  return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));  }
+
+struct SyncWaitState
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    std::exception_ptr error;
+
+    void finish()
+    {
+        // 在鎖內通知：等待的一方醒來後就會銷毀這個物件
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        cv.notify_one();
+    }
+};
+
+template<typename T, typename Result>
+Detached runSyncWait(Task<T>& task, Result& result, SyncWaitState& state)
+{
+    try
+    {
+        if constexpr (std::is_void_v<T>)
+            co_await std::move(task);
+        else
+            result.emplace(co_await std::move(task));
+    }
+    catch (...)
+    {  state.error = std::current_exception();  }
+
+    state.finish();
+}
+
+} // namespace detail
+
+// 在目前的執行緒上開始 task 並阻塞到完成；只應在 pool 之外（例如 main）使用
+template<typename T>
+T syncWait(Task<T> task)
+{
+    using Result = std::optional<std::conditional_t<std::is_void_v<T>, bool, T>>;
+    Result result;
+    detail::SyncWaitState state;
+
+    detail::runSyncWait(task, result, state);
+
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.cv.wait(lock, [&] { return state.done; });
+
+    if (state.error)
+        std::rethrow_exception(state.error);
+    if constexpr (!std::is_void_v<T>)
+        return std::move(*result);
+}
+
+} // namespace ConcurrentEngine::Coro
+
+#endif // CONCURRENTENGINE_COROUTINE_COROTASK_HPP
@@ -0,0 +1,124 @@
+#ifndef THREAD_LOGGER_FORMAT_HPP
+#define THREAD_LOGGER_FORMAT_HPP
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace LogFormat
+{
+
+// 固定大小的輸出緩衝區，超出容量的內容直接截斷
+struct Buffer
+{
+    char* data;
+    size_t capacity;
+    size_t length = 0;
+
+    void append(std::string_view text)
+    {
+        size_t n = std::min(text.size(), capacity - length);
+        std::memcpy(data + length, text.data(), n);
+        length += n;
+    }
+
+    void append(char c)
+    {
+        if (length < capacity)
+            data[length++] = c;
+    }
+
+    template<typename T>
+    void appendNumber(T value)
+    {
+        char tmp[64];
+        auto result = std::to_chars(tmp, tmp + sizeof(tmp), value);
+        append(std::string_view(tmp, static_cast<size_t>(result.ptr - tmp)));
+    }
+};
+
+template<typename T>
+concept Streamable = requires(std::ostream& os, const T& value) { os << value; };
+
+template<typename T>
+void appendArg(Buffer& out, const T& value)
+{
+    using U = std::decay_t<T>;
+
+    if constexpr (std::is_same_v<U, bool>)
+        out.append(value ? "true" : "false");
+    else if constexpr (std::is_same_v<U, char>)
+        out.append(value);
+    else if constexpr (std::is_integral_v<U> || std::is_floating_point_v<U>)
+        out.appendNumber(value);
+    else if constexpr (std::is_enum_v<U>)
+        out.appendNumber(static_cast<std::underlying_type_t<U>>(value));
+    else if constexpr (std::is_same_v<U, const char*> || std::is_same_v<U, char*>)
+        out.append(value ? std::string_view(value) : std::string_view("(null)"));
+    else if constexpr (std::is_convertible_v<const U&, std::string_view>)
+        out.append(std::string_view(value));
+    else if constexpr (std::is_pointer_v<U>)
+    {
+        out.append("0x");
+        char tmp[32];
+        auto result = std::to_chars(tmp, tmp + sizeof(tmp),
+                                    reinterpret_cast<std::uintptr_t>(value), 16);
+        out.append(std::string_view(tmp, static_cast<size_t>(result.ptr - tmp)));
+    }
+    else if constexpr (Streamable<U>)
+    {
+        // 其他型別（例如 std::thread::id）退回 operator<<
+        std::ostringstream ss;
+        ss << value;
+        out.append(ss.str());
+    }
+    else
+        static_assert(sizeof(U) == 0, "LogFormat: unsupported argument type");
+}
+
+// 將 "{}" 依序替換成引數，"{{" / "}}" 輸出為單一大括號
+inline void formatTo(Buffer& out, std::string_view fmt)
+{
+    for (size_t i = 0; i < fmt.size(); ++i)
+    {
+        char c = fmt[i];
+        if ((c == '{' || c == '}') && i + 1 < fmt.size() && fmt[i + 1] == c)
+            ++i;
+        out.append(c);
+    }
+}
+
+template<typename First, typename... Rest>
+void formatTo(Buffer& out, std::string_view fmt, const First& first, const Rest&... rest)
+{
+    for (size_t i = 0; i < fmt.size(); ++i)
+    {
+        char c = fmt[i];
+        if (c == '{' && i + 1 < fmt.size())
+        {
+            if (fmt[i + 1] == '}')
+            {
+                appendArg(out, first);
+                formatTo(out, fmt.substr(i + 2), rest...);
+                return;
+            }
+            if (fmt[i + 1] == '{')
+                ++i;
+        }
+        else if (c == '}' && i + 1 < fmt.size() && fmt[i + 1] == '}')
+        {
+            ++i;
+        }
+        out.append(c);
+    }
+}
+
+} // namespace LogFormat
+
+#endif // THREAD_LOGGER_FORMAT_HPP
@@ -2,22 +2,25 @@
 #define THREAD_LOGGER_HPP
 
 #include <string>
+#include <string_view>
 #include <mutex>
 #include <fstream>
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <threadPool/logger/logFormat.hpp>
 
 #ifdef QT_CORE_LIB
 #include <QString>
 #include <functional>
 #endif
 
-#define LOG(X)  ThreadLogger::getInstance().log(X)
-#define LOG_INFO(X)  ThreadLogger::getInstance().log(X, LogLevel::INFO)
-#define LOG_WARN(X)  ThreadLogger::getInstance().log(X, LogLevel::WARN)
-#define LOG_ERROR(X) ThreadLogger::getInstance().log(X, LogLevel::ERROR)
-#define LOG_DEBUG(X) ThreadLogger::getInstance().log(X, LogLevel::DEBUG)
-
-
-enum class LogLevel 
+enum class LogLevel
 {
     INFO,
     WARN,
@@ -25,34 +28,181 @@ enum class LogLevel
     DEBUG
 };
 
-class ThreadLogger 
+// 嚴重程度：DEBUG < INFO < WARN < ERROR（與列舉值順序無關）
+constexpr int logSeverity(LogLevel level)
+{
+    switch (level)
+    {
+        case LogLevel::DEBUG: return 0;
+        case LogLevel::INFO:  return 1;
+        case LogLevel::WARN:  return 2;
+        case LogLevel::ERROR: return 3;
+    }
+    return 0;
+}
+
+// 編譯期最低等級：0=DEBUG 1=INFO 2=WARN 3=ERROR 4=OFF
+// 低於此等級的 LOG_* 直接展開為 ((void)0)，引數不會被求值
+#ifndef CE_LOG_MIN_LEVEL
+#define CE_LOG_MIN_LEVEL 0
+#endif
+
+// 先做執行期等級檢查，通過後才格式化（"{}" 佔位符）
+#define CE_LOG_AT(level, tid, ...)                                              \
+    do {                                                                        \
+        if (ThreadLogger::getInstance().shouldLog(level))                       \
+            ThreadLogger::getInstance().logf(level, tid, __VA_ARGS__);          \
+    } while (0)
+
+#if CE_LOG_MIN_LEVEL <= 0
+#define LOG_DEBUG(...)         CE_LOG_AT(LogLevel::DEBUG, -1, __VA_ARGS__)
+#define LOG_DEBUG_T(tid, ...)  CE_LOG_AT(LogLevel::DEBUG, tid, __VA_ARGS__)
+#else
+#define LOG_DEBUG(...)         ((void)0)
+#define LOG_DEBUG_T(tid, ...)  ((void)0)
+#endif
+
+#if CE_LOG_MIN_LEVEL <= 1
+#define LOG_INFO(...)          CE_LOG_AT(LogLevel::INFO, -1, __VA_ARGS__)
+#define LOG_INFO_T(tid, ...)   CE_LOG_AT(LogLevel::INFO, tid, __VA_ARGS__)
+#else
+#define LOG_INFO(...)          ((void)0)
+#define LOG_INFO_T(tid, ...)   ((void)0)
+#endif
+
+#if CE_LOG_MIN_LEVEL <= 2
+#define LOG_WARN(...)          CE_LOG_AT(LogLevel::WARN, -1, __VA_ARGS__)
+#define LOG_WARN_T(tid, ...)   CE_LOG_AT(LogLevel::WARN, tid, __VA_ARGS__)
+#else
+#define LOG_WARN(...)          ((void)0)
+#define LOG_WARN_T(tid, ...)   ((void)0)
+#endif
+
+#if CE_LOG_MIN_LEVEL <= 3
+#define LOG_ERROR(...)         CE_LOG_AT(LogLevel::ERROR, -1, __VA_ARGS__)
+#define LOG_ERROR_T(tid, ...)  CE_LOG_AT(LogLevel::ERROR, tid, __VA_ARGS__)
+#else
+#define LOG_ERROR(...)         ((void)0)
+#define LOG_ERROR_T(tid, ...)  ((void)0)
+#endif
+
+#define LOG(...)  LOG_INFO(__VA_ARGS__)
+
+// 每執行緒 ring buffer 已滿時的處理方式
+enum class LogOverflowPolicy
+{
+    DROP,   // 丟棄並計數
+    BLOCK   // 等待背景執行緒消化
+};
+
+// 非同步 logger：
+// - log() 只把紀錄寫進呼叫執行緒自己的無鎖 ring buffer
+// - 背景執行緒負責時間格式化、上色、console / 檔案輸出
+class ThreadLogger
 {
 public:
+    static constexpr size_t kMaxMessageLength = 232;
+    static constexpr size_t kRingCapacity = 512;
+
     static ThreadLogger& getInstance();
 
-    void log(const std::string& message, LogLevel level = LogLevel::INFO, int threadID = -1);
+    void log(std::string_view message, LogLevel level = LogLevel::INFO, int threadID = -1);
+
+    // 格式化版本，直接寫入堆疊緩衝區，不建立 std::string
+    template<typename... Args>
+    void logf(LogLevel level, int threadID, std::string_view fmt, const Args&... args)
+    {
+        char text[kMaxMessageLength];
+        LogFormat::Buffer out{text, sizeof(text)};
+        LogFormat::formatTo(out, fmt, args...);
+        log(std::string_view(text, out.length), level, threadID);
+    }
+
+    // 執行期最低等級，預設 DEBUG（全部輸出）
+    void setLevel(LogLevel level) { minSeverity_.store(logSeverity(level), std::memory_order_relaxed); }
+    bool shouldLog(LogLevel level) const
+    {  return logSeverity(level) >= minSeverity_.load(std::memory_order_relaxed);  }
+
+    // 等待目前為止所有執行緒寫入的紀錄都輸出完畢
+    void flush();
+
+    void setOverflowPolicy(LogOverflowPolicy policy);
+    size_t droppedCount() const;
 
     void enableFileLogging(const std::string& filename = "thread.log");
     void disableFileLogging();
-    
+
 #ifdef QT_CORE_LIB
     void setGuiLogCallback(std::function<void(const QString&)> callback);
 #endif
 
 private:
-    ThreadLogger() = default;
+    struct LogRecord
+    {
+        std::chrono::steady_clock::time_point time;  // 背景執行緒再換算成系統時間
+        LogLevel level;
+        int threadID;
+        uint32_t length;
+        char text[kMaxMessageLength];
+    };
+
+    // 單一生產者（擁有的執行緒）/ 單一消費者（背景執行緒）
+    struct LogRing
+    {
+        alignas(64) std::atomic<size_t> head{0};  // 消費者位置
+        alignas(64) std::atomic<size_t> tail{0};  // 生產者位置
+        std::atomic<bool> orphaned{false};        // 擁有的執行緒已結束
+        LogRecord records[kRingCapacity];
+    };
+
+    struct RingHandle;
+
+    ThreadLogger();
+    ~ThreadLogger();
     ThreadLogger(const ThreadLogger&) = delete;
     ThreadLogger& operator=(const ThreadLogger&) = delete;
 
-    std::mutex logMutex_;
+    LogRing& localRing();
+    void wakeWriter();
+    void writerLoop();
+    size_t drain(std::vector<LogRecord>& batch);
+    bool hasPending();
+    void writeBatch(std::vector<LogRecord>& batch);
+
+    std::mutex logMutex_;   // 保護檔案與 GUI callback
     bool logToFile_ = false;
     std::ofstream logFile_;
 
+    std::mutex registryMutex_;
+    std::vector<std::shared_ptr<LogRing>> rings_;
+
+    std::atomic<int> minSeverity_{0};
+    std::atomic<LogOverflowPolicy> overflowPolicy_{LogOverflowPolicy::DROP};
+    std::atomic<size_t> dropped_{0};
+    size_t droppedReported_ = 0;
+
+    std::mutex wakeMutex_;
+    std::condition_variable wakeCv_;
+    std::atomic<bool> writerIdle_{false};
+    std::atomic<bool> stopping_{false};
+
+    std::mutex flushMutex_;
+    std::condition_variable flushCv_;
+    std::atomic<uint64_t> flushRequested_{0};
+    uint64_t flushCompleted_ = 0;
+
+    const std::chrono::system_clock::time_point wallBase_ = std::chrono::system_clock::now();
+    const std::chrono::steady_clock::time_point steadyBase_ = std::chrono::steady_clock::now();
+    std::time_t cachedSecond_ = -1;
+    std::string cachedTimestamp_;
+
 #ifdef QT_CORE_LIB
     std::function<void(const QString&)> guiLogCallback_;
 #endif
 
-    std::string getTimestamp();
+    std::thread writer_;  // 最後建構：其他成員就緒後才啟動
+
+    std::string getTimestamp(std::chrono::system_clock::time_point time);
     std::string getColorPrefix(LogLevel level);
 };
 
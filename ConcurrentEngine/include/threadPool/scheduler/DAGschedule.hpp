@@ -2,7 +2,14 @@
 #define CONCURRENTENGINE_SCHEDULER_DAGSCHEDULER_HPP
 
 #include <threadPool/scheduler/Ischedule.hpp>
+#include <threadPool/scheduler/taskGraph.hpp>
+#include <threadPool/core/ringQueue.hpp>
+#include <threadPool/core/cancellation.hpp>
+#include <threadPool/core/waitStrategy.hpp>
 #include <threadPool/logger/threadLogger.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <functional>
 #include <vector>
 #include <queue>
@@ -10,31 +17,171 @@
 #include <condition_variable>
 #include <iostream>
 #include <memory>
+#include <atomic>
+#include <exception>
+#include <future>
 
 namespace ConcurrentEngine::Scheduler
 {
 
-using Task = std::function<void()>;
+// 一組 DAG 節點的完成通知：以 submitDAG(node, deps, group) 加入的節點全部完成後觸發
+// - wait() / future() 會封閉這一組，之後不能再加入節點（避免前面的節點先跑完就提早觸發）
+// - 任一節點拋出例外時，future 帶著第一個例外完成，wait() 會重新拋出
+// - 完成後 stats() 提供實測的關鍵路徑、總工作量與工作執行緒使用率（makespan 從第一個節點加入起算）
+class DAGCompletion
+{
+public:
+    DAGCompletion() : future_(promise_.get_future().share()) {}
+
+    DAGCompletion(const DAGCompletion&) = delete;
+    DAGCompletion& operator=(const DAGCompletion&) = delete;
+
+    void wait()
+    {
+        seal();
+        future_.get();
+    }
+
+    std::shared_future<void> future()
+    {
+        seal();
+        return future_;
+    }
+
+    // 尚未完成的節點數
+    size_t pending() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_ - (sealed_ ? 0 : 1);
+    }
+
+    // 完成前呼叫時為目前累計的值
+    GraphRunStats stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+private:
+    friend class DAGScheduler;
+
+    // 加入一個節點；已封閉時回傳 false
+    bool add()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (sealed_) return false;
+        if (beginNs_ == 0)
+            beginNs_ = std::chrono::steady_clock::now().time_since_epoch().count();
+        ++pending_;
+        return true;
+    }
+
+    void seal()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (sealed_) return;
+        sealed_ = true;
+        releaseLocked(lock);
+    }
+
+    // durationNs：節點實測時間；pathNs：以該節點結尾的最長實測路徑；workers：目前的工作執行緒數
+    void finish(std::exception_ptr error, int64_t durationNs, int64_t pathNs, size_t workers)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (error && !error_)
+            error_ = std::move(error);
+        stats_.participants = std::max(stats_.participants, workers);
+        stats_.work += std::chrono::nanoseconds(durationNs);
+        stats_.criticalPath = std::max(stats_.criticalPath, std::chrono::nanoseconds(pathNs));
+        releaseLocked(lock);
+    }
+
+    void releaseLocked(std::unique_lock<std::mutex>& lock)
+    {
+        if (--pending_ != 0) return;
+
+        if (beginNs_ != 0)
+        {
+            stats_.makespan = std::chrono::nanoseconds(std::chrono::steady_clock::now().time_since_epoch().count() - beginNs_);
+            const double capacity = static_cast<double>(stats_.makespan.count()) * static_cast<double>(std::max<size_t>(1, stats_.participants));
+            stats_.utilization = capacity > 0 ? static_cast<double>(stats_.work.count()) / capacity : 0.0;
+            LOG_INFO("[DAGScheduler] Group done: makespan {} us, critical path {} us, work {} us, utilization {}%",
+                     stats_.makespan.count() / 1000, stats_.criticalPath.count() / 1000,
+                     stats_.work.count() / 1000, static_cast<int>(stats_.utilization * 100));
+        }
+
+        std::exception_ptr error = error_;
+        lock.unlock();
+        if (error)
+            promise_.set_exception(error);
+        else
+            promise_.set_value();
+    }
+
+    mutable std::mutex mutex_;
+    size_t pending_ = 1;   // 多算的 1 由 seal() 扣除
+    bool sealed_ = false;
+    int64_t beginNs_ = 0;
+    GraphRunStats stats_;
+    std::exception_ptr error_;
+    std::promise<void> promise_;
+    std::shared_future<void> future_;
+};
+
+using DAGHandle = std::shared_ptr<DAGCompletion>;
 
-// 單一任務節點，包含依賴計數及依賴節點列表（弱指標避免循環引用）
+// 單一任務節點，包含尚未完成的依賴數及後繼節點列表
+// - dependencyCount 以原子遞減，歸零的那一方負責排程，不需取 Scheduler 的全域鎖
+// - dependents 只在加入依賴與節點完成時受 dependentsMutex 保護；完成時整批取出，
+//   因此後繼節點只被持有到前驅完成為止，不會留下循環引用
+// - cost 為使用者提供的相對執行時間估計；rank = cost + 後繼中最大的 rank，
+//   即到終點的最長剩餘路徑，就緒佇列依此排序
+// - token 被取消（或任一前驅被取消）的節點輪到時不執行，以 TaskCancelled 放棄並把取消傳給所有後繼
 struct TaskNode 
 {
-    explicit TaskNode(Task t) : task(std::move(t)) {}
+    explicit TaskNode(Task t, double costHint = 1.0, CancellationToken cancelToken = CancellationToken(nullptr))
+        : task(std::move(t)), cost(costHint), token(std::move(cancelToken)) {}
     Task task;
-    int dependencyCount = 0;
-    std::vector<std::weak_ptr<TaskNode>> dependents;
+    double cost = 1.0;
+    CancellationToken token;
+    std::atomic<int> dependencyCount{0};
+    std::vector<std::shared_ptr<TaskNode>> dependents;
+    std::mutex dependentsMutex;
+    bool completed = false;   // 受 dependentsMutex 保護
+    bool skipped = false;     // 以取消結束，受 dependentsMutex 保護
+    DAGHandle group;          // 所屬的完成通知，可為空
+
+    std::atomic<bool> upstreamCancelled{false};   // 在釋放本節點的 fetch_sub 之前寫入
+
+    bool isCancelled() const
+    {  return upstreamCancelled.load(std::memory_order_relaxed) || token.isCancelled();  }
+
+    std::atomic<double> rank{0.0};
+    std::atomic<bool> released{false};                   // 已進入就緒佇列（之後不再更新 rank）
+    std::vector<std::weak_ptr<TaskNode>> predecessors;   // 受 DAGScheduler::submitMutex_ 保護，只用於更新 rank
+    std::atomic<int64_t> pathNs{0};                      // 前驅中最長的實測路徑
 };
 
-class DAGScheduler : public IScheduler
+class DAGScheduler final : public IScheduler
 {
 public:
     DAGScheduler() = default;
 
+    void onWorkerStart(const WorkerInfo&) override {  workers_.fetch_add(1, std::memory_order_relaxed);  }
+    void onWorkerStop(const WorkerInfo&) override {  workers_.fetch_sub(1, std::memory_order_relaxed);  }
+
+    // 普通 Task 視為沒有依賴的就緒任務（TaskGraph 以此派送節點，不需建立 TaskNode）
     void addTask(Task task) override;
-    void addTask(std::shared_ptr<TaskNode> node,
-                 const std::vector<std::shared_ptr<TaskNode>>& dependencies);
+    void addTasks(std::span<Task> tasks) override;
+
+    // 加入 DAG 節點；dependencies 會形成循環（包含依賴自己）或 group 已封閉時拒絕並回傳 false
+    bool addTask(std::shared_ptr<TaskNode> node,
+                 const std::vector<std::shared_ptr<TaskNode>>& dependencies,
+                 DAGHandle group = nullptr);
 
     Task getTask() override;
+    Task getTaskFor(std::chrono::milliseconds timeout) override;
+
     void reportStatus() override;
     void notifyAll() override;
 
@@ -42,19 +189,48 @@ public:
     void setMaxQueueSize(size_t) override;
 
     size_t size() const override;
+    void setWaitStrategy(const WaitStrategy& strategy) override {  idle_.setStrategy(strategy);  }
 
     void start() override {}
     void stop() override {}
 
 private:
-    void taskCompleted(std::shared_ptr<TaskNode> node);
-
-    std::queue<std::shared_ptr<TaskNode>> readyQueue_;
+    std::shared_ptr<TaskNode> taskCompleted(TaskNode& node, int64_t pathNs, bool cancelled);
+    void propagateRank(const std::shared_ptr<TaskNode>& node,
+                       const std::vector<std::shared_ptr<TaskNode>>& dependencies);
+    void pushReadyLocked(std::shared_ptr<TaskNode> node);
+    std::shared_ptr<TaskNode> popReadyLocked();
+    bool createsCycle(const std::shared_ptr<TaskNode>& node,
+                      const std::vector<std::shared_ptr<TaskNode>>& dependencies) const;
+    void pushReady(std::shared_ptr<TaskNode> node);
+    Task takeReady();
+    bool hasReady() const { return !readyQueue_.empty() || !readyTasks_.empty(); }
+    void syncReadyCount() {  readyCount_.store(readyQueue_.size() + readyTasks_.size(), std::memory_order_relaxed);  }
+    bool hasWork() const;
+    bool tryTake(Task& task);
+
+    // 就緒節點的 max-heap：rank 大者優先，相同時先進先出
+    struct ReadyEntry
+    {
+        double rank;
+        uint64_t seq;
+        std::shared_ptr<TaskNode> node;
+
+        bool operator<(const ReadyEntry& other) const
+        {  return rank < other.rank || (rank == other.rank && seq > other.seq);  }
+    };
+
+    std::vector<ReadyEntry> readyQueue_;
+    uint64_t readySeq_ = 0;
+    std::atomic<size_t> workers_{0};
+    RingQueue<Task> readyTasks_;
+    std::atomic<size_t> readyCount_{0};   // 兩個就緒佇列的總長，閒置自旋時不取鎖讀取
     mutable std::mutex mutex_;
-    std::condition_variable cv_;
+    IdleWaiter idle_;
+    std::mutex submitMutex_;   // 循環檢查與登記依賴須一起完成，兩個並行的 addTask 才不會合力組成循環
 
 private:
-    bool running_ = true;
+    std::atomic<bool> running_{true};
 
 };
 
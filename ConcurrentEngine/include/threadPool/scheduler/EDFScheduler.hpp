@@ -0,0 +1,100 @@
+#ifndef CONCURRENTENGINE_SCHEDULER_EDFSCHEDULER_HPP
+#define CONCURRENTENGINE_SCHEDULER_EDFSCHEDULER_HPP
+
+#include <threadPool/scheduler/Ischedule.hpp>
+#include <threadPool/logger/threadLogger.hpp>
+#include <threadPool/core/waitStrategy.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+using Deadline = std::chrono::steady_clock::time_point;
+
+// 任務在開始執行前就已超過期限，回傳 future 的提交會收到這個例外
+class DeadlineExpired : public std::runtime_error
+{
+public:
+    DeadlineExpired() : std::runtime_error("[EDFScheduler] Task deadline expired before it started") {}
+};
+
+// Earliest-Deadline-First：以期限排序的 min-heap，期限相同時先進先出
+// - 取出時已超過期限的任務不交給工作執行緒，直接以 DeadlineExpired 放棄並計數
+// - 沒有期限的任務（addTask(task)）排在所有有期限的任務之後
+class EDFScheduler final : public IScheduler
+{
+public:
+    EDFScheduler() = default;
+
+    void addTask(Task task, Deadline deadline);
+    void addTask(Task task) override;
+
+    void addTasks(std::span<Task> tasks, Deadline deadline);
+    void addTasks(std::span<Task> tasks) override;
+
+    SubmitStatus tryAddTask(Task& task, Deadline deadline);
+    SubmitStatus tryAddTask(Task& task) override;
+    size_t tryAddTasks(std::span<Task> tasks, Deadline deadline);
+    size_t tryAddTasks(std::span<Task> tasks) override;
+
+    Task getTask() override;
+    Task getTaskFor(std::chrono::milliseconds timeout) override;
+
+    void reportStatus() override;
+    void notifyAll() override;
+    void setRejectPolicy(RejectPolicy policy) override;
+    void setMaxQueueSize(size_t maxSize) override;
+    size_t size() const override;
+    void setWaitStrategy(const WaitStrategy& strategy) override {  idle_.setStrategy(strategy);  }
+
+    void start() override {}
+    void stop() override {}
+
+    // 因超過期限而放棄的任務數
+    uint64_t expiredCount() const {  return expired_.load(std::memory_order_relaxed);  }
+
+private:
+    struct Entry
+    {
+        int64_t deadlineNs;
+        uint64_t seq;
+        Task task;
+
+        // std::push_heap 為 max-heap，反過來比較得到最早期限在頂端
+        bool operator<(const Entry& other) const
+        {  return deadlineNs > other.deadlineNs || (deadlineNs == other.deadlineNs && seq > other.seq);  }
+    };
+
+    bool waitForSpace(std::unique_lock<std::mutex>& lock, Task& evicted);
+    Task evictLocked();
+    void pushLocked(Task&& task, int64_t deadlineNs);
+    Entry popLocked();
+    Task takeLive(std::unique_lock<std::mutex>& lock);
+    void expire(Task task);
+    bool hasWork() const;
+    bool tryTake(Task& task);
+
+    std::vector<Entry> heap_;
+    std::atomic<size_t> queued_{0};  // heap_.size()，閒置自旋時不取鎖讀取
+    uint64_t seq_ = 0;
+    std::atomic<uint64_t> expired_{0};
+
+    mutable std::mutex mutex_;
+    std::condition_variable cvFull_;
+    IdleWaiter idle_;
+
+    std::atomic<bool> running_{true};
+    RejectPolicy rejectPolicy_ = RejectPolicy::BLOCK;
+    size_t maxQueueSize_ = 0;
+};
+
+} // namespace ConcurrentEngine::Scheduler
+
+#endif // CONCURRENTENGINE_SCHEDULER_EDFSCHEDULER_HPP
@@ -2,18 +2,25 @@
 #define CONCURRENTENGINE_SCHEDULER_FIFOSCHEDULER_HPP
 
 #include <threadPool/scheduler/Ischedule.hpp>
+#include <threadPool/core/ringQueue.hpp>
+#include <threadPool/core/waitStrategy.hpp>
+#include <atomic>
 #include <queue>
+#include <vector>
 #include <mutex>
 #include <condition_variable>
 #include <iostream>
+#include <threadPool/logger/threadLogger.hpp>
 
 namespace ConcurrentEngine::Scheduler 
 {
 
-class FIFOScheduler : public IScheduler 
+// 每個 NUMA node 一個子佇列（共用同一把鎖）：任務放入提交者所在 node 的佇列，
+// 工作執行緒優先取自己 node 的任務；單一 node 的機器上即為一般 FIFO
+class FIFOScheduler final : public IScheduler 
 {
 public:
-    FIFOScheduler() = default;
+    FIFOScheduler();
 
     size_t size() const override;
 
@@ -23,23 +30,36 @@ public:
     void setMaxQueueSize(size_t maxSize) override;
 
     void addTask(Task task) override;
+    void addTasks(std::span<Task> tasks) override;
+    SubmitStatus tryAddTask(Task& task) override;
+    size_t tryAddTasks(std::span<Task> tasks) override;
 
     Task getTask() override;
+    Task getTaskFor(std::chrono::milliseconds timeout) override;
 
     void reportStatus() override;
 
     void notifyAll() override;
 
+    void setWaitStrategy(const WaitStrategy& strategy) override {  idle_.setStrategy(strategy);  }
+
     void start() override {}
     void stop() override {}
 
 private:
-    std::queue<Task> taskQueue_;
+    size_t localNode() const;
+    void pushLocked(Task&& task, size_t node);
+    Task popLocked(size_t node);
+    bool hasWork() const;
+    bool tryTake(Task& task);
+
+    std::vector<RingQueue<Task>> nodeQueues_;
+    std::atomic<size_t> queuedCount_{0};  // 只在 mutex_ 內修改；閒置自旋時不取鎖讀取
     mutable std::mutex mutex_;
-    std::condition_variable cv_;
     std::condition_variable cvFull_;
+    IdleWaiter idle_;
 
-    bool running_ = true;
+    std::atomic<bool> running_{true};
     RejectPolicy rejectPolicy_ = RejectPolicy::BLOCK;
     size_t maxQueueSize_ = 0;
 };
@@ -1,19 +1,88 @@
 #ifndef CONCURRENTENGINE_SCHEDULER_ISCHEDULER_HPP
 #define CONCURRENTENGINE_SCHEDULER_ISCHEDULER_HPP
 
-#include <functional>
+#include <threadPool/core/taskFunction.hpp>
+#include <threadPool/core/waitStrategy.hpp>
+#include <chrono>
 #include <cstddef>
+#include <exception>
+#include <span>
+#include <stdexcept>
+#include <utility>
 
 namespace ConcurrentEngine::Scheduler 
 {
 
-using Task = std::function<void()>;
+// 只能移動、小型閉包免配置的任務型別
+using Task = ConcurrentEngine::TaskFunction;
 
+// 佇列已滿時的處理方式（DAG / WorkStealing 沒有容量上限，不適用）
 enum class RejectPolicy 
 {
-    BLOCK,
-    DISCARD,
-    THROW
+    BLOCK,         // 提交者等待空間
+    DISCARD,       // 放棄新任務，future 收到 TaskRejected
+    THROW,         // 提交者收到 TaskRejected 例外
+    CALLER_RUNS,   // 在提交者的執行緒上直接執行，提交速度因此被拉慢（自然的背壓）；一般任務的例外拋給提交者
+    DROP_OLDEST    // 放棄佇列中最舊的任務（future 收到 TaskRejected）再放入新任務
+                   // Priority 取最低優先級中最舊的，EDF 取期限最晚的
+};
+
+// trySubmit / tryAddTask 的結果
+enum class SubmitStatus
+{
+    ACCEPTED,
+    QUEUE_FULL,      // 佇列已滿，任務仍留在呼叫端
+    STOPPED,         // ThreadPool 未啟動或已停止
+    NOT_SUPPORTED    // Scheduler 不接受普通任務（DAG）
+};
+
+// 任務因佇列已滿被拒絕或放棄：THROW 直接拋出，DISCARD / DROP_OLDEST 交給任務的 future
+class TaskRejected : public std::runtime_error
+{
+public:
+    explicit TaskRejected(const char* reason) : std::runtime_error(reason) {}
+};
+
+namespace detail
+{
+
+// 不執行而放棄任務，future 收到 TaskRejected；不可在 Scheduler 的鎖內呼叫
+inline void rejectTask(Task& task, const char* reason)
+{  task.fail(std::make_exception_ptr(TaskRejected(reason)));  }
+
+// 批次提交中放不下的任務：CALLER_RUNS 依序在呼叫端執行（例外在全部執行完後重新拋出第一個），
+// 其他策略以 TaskRejected 放棄
+inline void handleOverflow(RejectPolicy policy, std::span<Task> tasks, const char* reason)
+{
+    std::exception_ptr error;
+    for (Task& task : tasks)
+    {
+        if (policy != RejectPolicy::CALLER_RUNS)
+        {
+            rejectTask(task, reason);
+            continue;
+        }
+
+        try
+        {  task();  }
+        catch (...)
+        {
+            if (!error) error = std::current_exception();
+        }
+    }
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+} // namespace detail
+
+// 工作執行緒身分，由 ThreadPool 在執行緒啟動時交給 Scheduler
+struct WorkerInfo
+{
+    int id = -1;
+    int cpu = -1;        // 綁定的 CPU（未綁定或綁在整個 node 時為 -1）
+    int numaNode = -1;   // 所在 NUMA node（未知時為 -1）
 };
 
 class IScheduler 
@@ -22,14 +91,53 @@ public:
     virtual ~IScheduler() = default;
 
     virtual void addTask(Task task) = 0;
+
+    // 批次加入（任務會被移出 span）；預設逐一 addTask，具體 Scheduler 可只取一次鎖
+    virtual void addTasks(std::span<Task> tasks)
+    {
+        for (Task& task : tasks)
+            addTask(std::move(task));
+    }
+
+    // 不阻塞、不拋例外的加入：佇列已滿時回傳 QUEUE_FULL 且不取走 task，不套用 RejectPolicy
+    // 預設給沒有容量上限的 Scheduler：一律加入
+    virtual SubmitStatus tryAddTask(Task& task)
+    {
+        addTask(std::move(task));
+        return SubmitStatus::ACCEPTED;
+    }
+
+    // 不阻塞的批次加入：依序放入放得下的前段任務並回傳數量，其餘留在 span 中，不套用 RejectPolicy
+    // 預設逐一 tryAddTask，具體 Scheduler 可只取一次鎖
+    virtual size_t tryAddTasks(std::span<Task> tasks)
+    {
+        size_t accepted = 0;
+        while (accepted < tasks.size() && tryAddTask(tasks[accepted]) == SubmitStatus::ACCEPTED)
+            ++accepted;
+        return accepted;
+    }
+
     virtual Task getTask() = 0;
+
+    // 最多等待 timeout，逾時回傳空任務（ThreadPool 用來判斷閒置執行緒是否回收）
+    // 預設不支援逾時，直接等到有任務為止
+    virtual Task getTaskFor(std::chrono::milliseconds /*timeout*/) {  return getTask();  }
+
     virtual void reportStatus() = 0;
     virtual void notifyAll() = 0;
     virtual void setRejectPolicy(RejectPolicy policy) = 0;
     virtual void setMaxQueueSize(size_t maxSize) = 0;
     virtual size_t size() const = 0;
+
+    // 工作執行緒閒置時的 spin / yield / 休眠方式，須在 start() 前設定；預設忽略
+    virtual void setWaitStrategy(const WaitStrategy&) {}
+
     virtual void start() = 0;
     virtual void stop() = 0;
+
+    // 工作執行緒啟動 / 結束時呼叫（在該執行緒上），預設不需要執行緒身分
+    virtual void onWorkerStart(const WorkerInfo&) {}
+    virtual void onWorkerStop(const WorkerInfo&) {}
 };
 
 } // namespace ConcurrentEngine::Scheduler
@@ -0,0 +1,76 @@
+#ifndef CONCURRENTENGINE_SCHEDULER_LOCKFREEFIFOSCHEDULER_HPP
+#define CONCURRENTENGINE_SCHEDULER_LOCKFREEFIFOSCHEDULER_HPP
+
+#include <threadPool/scheduler/Ischedule.hpp>
+#include <threadPool/core/mpmcRingBuffer.hpp>
+#include <threadPool/core/waitStrategy.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <iostream>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+// FIFOScheduler 的無鎖版本：固定容量的 MPMC 環形佇列
+// 只有在佇列真的空（消費者）或滿（BLOCK 策略的生產者）時才會進入等待
+class LockFreeFIFOScheduler final : public IScheduler
+{
+public:
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    explicit LockFreeFIFOScheduler(size_t capacity = kDefaultCapacity);
+
+    size_t size() const override;
+
+    void setRejectPolicy(RejectPolicy policy) override;
+    void getRejectPolicy() const;
+
+    // 以新容量重建環形佇列，須在 ThreadPool 啟動前呼叫（之後的呼叫會被忽略）；0 代表使用預設容量，最小容量為 2
+    void setMaxQueueSize(size_t maxSize) override;
+
+    void addTask(Task task) override;
+    void addTasks(std::span<Task> tasks) override;
+    SubmitStatus tryAddTask(Task& task) override;
+    size_t tryAddTasks(std::span<Task> tasks) override;
+
+    Task getTask() override;
+    Task getTaskFor(std::chrono::milliseconds timeout) override;
+
+    void reportStatus() override;
+
+    void notifyAll() override;
+
+    void setWaitStrategy(const WaitStrategy& strategy) override {  idle_.setStrategy(strategy);  }
+
+    void start() override {}
+    void stop() override {}
+
+    void onWorkerStart(const WorkerInfo&) override {  workersStarted_.store(true, std::memory_order_release);  }
+
+private:
+    // BLOCK 策略的生產者等待空間用：等待者計數 + condition_variable，計數為 0 時消費者不必取鎖通知
+    struct Waiters
+    {
+        std::atomic<int> count{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+
+    bool enqueue(Task& task, RejectPolicy policy);  // 回傳是否放入；DISCARD / THROW / CALLER_RUNS 放不下時保留 task
+    void wake(Waiters& waiters, size_t count = 1);
+    bool tryTake(Task& task);
+
+    std::unique_ptr<MPMCRingBuffer<Task>> ring_;
+    IdleWaiter idle_;   // 消費者：佇列空時 spin / yield / 休眠
+    Waiters notFull_;
+
+    std::atomic<bool> running_{true};
+    std::atomic<bool> workersStarted_{false};   // 之後 setMaxQueueSize 不再替換 ring_
+    std::atomic<RejectPolicy> rejectPolicy_{RejectPolicy::BLOCK};
+};
+
+} // namespace ConcurrentEngine::Scheduler
+
+#endif // CONCURRENTENGINE_SCHEDULER_LOCKFREEFIFOSCHEDULER_HPP
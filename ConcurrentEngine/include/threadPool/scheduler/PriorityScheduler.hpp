@@ -2,31 +2,76 @@
 #define CONCURRENTENGINE_SCHEDULER_PRIORITYSCHEDULER_HPP
 
 #include <threadPool/scheduler/Ischedule.hpp>
-#include <queue>
+#include <threadPool/core/ringQueue.hpp>
+#include <threadPool/core/waitStrategy.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
 #include <condition_variable>
-#include <map>
 #include <iostream>
+#include <threadPool/logger/threadLogger.hpp>
 
 namespace ConcurrentEngine::Scheduler 
 {
 
 enum class TaskPriority { HIGH, MEDIUM, LOW};
 
-class PriorityScheduler : public IScheduler 
+// 數值優先級：0 最高、255 最低
+using PriorityLevel = uint8_t;
+inline constexpr size_t kPriorityLevels = 256;
+
+constexpr PriorityLevel toLevel(TaskPriority priority)
+{
+    switch (priority)
+    {
+        case TaskPriority::HIGH:   return 64;
+        case TaskPriority::LOW:    return 192;
+        default:                   return 128;
+    }
+}
+
+// 提交時的優先級：可直接傳 TaskPriority 或 0 ~ 255 的數值（超出範圍時夾到邊界）
+struct Priority
+{
+    PriorityLevel level;
+
+    constexpr Priority(TaskPriority priority) : level(toLevel(priority)) {}
+    constexpr Priority(int value) : level(static_cast<PriorityLevel>(std::clamp(value, 0, 255))) {}
+};
+
+// 256 個優先級各自一條 FIFO，以非空位元圖在 O(1) 內找到最高的非空優先級
+// 設定 aging 後，等待超過門檻的任務每經過一個門檻就往上提升 step 級，
+// 因此優先級 L 的任務最多約 ceil(L / step) 個門檻後就會到達最高級，不會無限期餓死
+class PriorityScheduler final : public IScheduler 
 {
 public:
     PriorityScheduler();
 
-    void addTask(Task task, TaskPriority priority = TaskPriority::MEDIUM);
+    void addTask(Task task, Priority priority = TaskPriority::MEDIUM);
     void addTask(Task task) override;
 
+    void addTasks(std::span<Task> tasks, Priority priority);
+    void addTasks(std::span<Task> tasks) override;
+
+    SubmitStatus tryAddTask(Task& task, Priority priority);
+    SubmitStatus tryAddTask(Task& task) override;
+    size_t tryAddTasks(std::span<Task> tasks, Priority priority);
+    size_t tryAddTasks(std::span<Task> tasks) override;
+
+    // threshold 為 0 時關閉 aging（預設）
+    void setAging(std::chrono::nanoseconds threshold, unsigned step = 32);
+
     Task getTask() override;
+    Task getTaskFor(std::chrono::milliseconds timeout) override;
     void reportStatus() override;
     void notifyAll() override;
     void setRejectPolicy(RejectPolicy policy) override;
     void getRejectPolicy() const;
     void setMaxQueueSize(size_t maxSize) override;
+    void setWaitStrategy(const WaitStrategy& strategy) override {  idle_.setStrategy(strategy);  }
 
     size_t size() const override
     {
@@ -38,17 +83,43 @@ public:
     void stop() override {};
 
 private:
-    size_t totalQueueSize() const;
+    struct Entry
+    {
+        Task task;
+        int64_t sinceNs;   // 進入目前優先級的時間，只在開啟 aging 時記錄
+    };
+
+    size_t totalQueueSize() const { return currentTaskCount_.load(std::memory_order_relaxed); }
+    void adjustCount(std::ptrdiff_t delta);
+    Task popHighest();
+    bool hasWork() const;
+    bool tryTake(Task& task);
+    void pushLocked(Task&& task, PriorityLevel level, int64_t nowNs);
+    void ageLocked(int64_t nowNs);
+    int64_t agingClock() const;
+
+    void markNonEmpty(PriorityLevel level) {  nonEmpty_[level >> 6] |= uint64_t{1} << (level & 63);  }
+    void markEmpty(PriorityLevel level) {  nonEmpty_[level >> 6] &= ~(uint64_t{1} << (level & 63));  }
+    int highestNonEmpty() const;
+    int lowestNonEmpty() const;
+    Task evictLocked();
+
+    std::array<RingQueue<Entry>, kPriorityLevels> queues_;
+    std::array<uint64_t, kPriorityLevels / 64> nonEmpty_{};
+
+    int64_t agingNs_ = 0;
+    unsigned agingStep_ = 32;
+    int64_t nextAgingNs_ = 0;
+    int64_t agingStartNs_ = 0;   // 最近一次開啟 aging 的時間
 
-    std::map<TaskPriority, std::queue<Task>> queues_;
     mutable std::mutex mutex_;
-    std::condition_variable cv_;
     std::condition_variable cvFull_;
+    IdleWaiter idle_;
 
-    bool running_;
+    std::atomic<bool> running_;
     RejectPolicy rejectPolicy_;
     size_t maxQueueSize_;
-    size_t currentTaskCount_;
+    std::atomic<size_t> currentTaskCount_;  // 只在 mutex_ 內修改；閒置自旋時不取鎖讀取
 };
 
 } // namespace ConcurrentEngine::Scheduler
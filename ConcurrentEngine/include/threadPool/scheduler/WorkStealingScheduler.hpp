@@ -0,0 +1,83 @@
+#ifndef CONCURRENTENGINE_SCHEDULER_WORKSTEALINGSCHEDULER_HPP
+#define CONCURRENTENGINE_SCHEDULER_WORKSTEALINGSCHEDULER_HPP
+
+#include <threadPool/scheduler/Ischedule.hpp>
+#include <threadPool/core/workStealingDeque.hpp>
+#include <threadPool/core/waitStrategy.hpp>
+#include <atomic>
+#include <queue>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <iostream>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+// 每個工作執行緒擁有自己的 Chase-Lev deque：
+// - 工作執行緒內提交的任務推入自己的 deque（無鎖）
+// - 外部執行緒提交的任務進入提交者所在 NUMA node 的 injection queue
+// - 閒置的工作執行緒先取同 node 的 injection queue，再從隨機的 victim 竊取（同 node 優先）
+class WorkStealingScheduler final : public IScheduler
+{
+public:
+    explicit WorkStealingScheduler(size_t maxWorkers = 64);
+    ~WorkStealingScheduler() override;
+
+    void addTask(Task task) override;
+    void addTasks(std::span<Task> tasks) override;
+    Task getTask() override;
+    Task getTaskFor(std::chrono::milliseconds timeout) override;
+
+    void reportStatus() override;
+    void notifyAll() override;
+
+    void setRejectPolicy(RejectPolicy) override;
+    void setMaxQueueSize(size_t) override;
+
+    size_t size() const override;
+    void setWaitStrategy(const WaitStrategy& strategy) override {  idle_.setStrategy(strategy);  }
+
+    void start() override {}
+    void stop() override {}
+
+    void onWorkerStart(const WorkerInfo& info) override;
+    void onWorkerStop(const WorkerInfo& info) override;
+
+private:
+    struct WorkerSlot
+    {
+        WorkStealingDeque<Task*> deque;
+        std::atomic<bool> occupied{false};
+        std::atomic<int> node{0};   // 佔用此 slot 的執行緒所在 NUMA node
+    };
+
+    struct InjectQueue
+    {
+        std::queue<Task*> queue;
+        std::mutex mutex;
+        std::atomic<size_t> size{0};
+    };
+
+    static constexpr size_t kNoSlot = static_cast<size_t>(-1);
+
+    size_t currentSlot() const;
+    size_t nodeOf(size_t slot) const;
+    Task* tryAcquire(size_t self);
+    Task* popInjected(size_t node);
+    Task* stealFrom(size_t self, size_t node);
+    bool tryTake(size_t self, Task& task);
+
+    std::vector<std::unique_ptr<WorkerSlot>> slots_;
+    std::atomic<size_t> slotHighWater_{0};
+
+    std::vector<std::unique_ptr<InjectQueue>> injectQueues_;   // 每個 NUMA node 一個
+
+    std::atomic<int64_t> pending_{0};
+    std::atomic<bool> running_{true};
+    IdleWaiter idle_;
+};
+
+} // namespace ConcurrentEngine::Scheduler
+
+#endif // CONCURRENTENGINE_SCHEDULER_WORKSTEALINGSCHEDULER_HPP
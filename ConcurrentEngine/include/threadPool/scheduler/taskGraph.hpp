@@ -0,0 +1,134 @@
+#ifndef CONCURRENTENGINE_SCHEDULER_TASKGRAPH_HPP
+#define CONCURRENTENGINE_SCHEDULER_TASKGRAPH_HPP
+
+#include <threadPool/scheduler/Ischedule.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+// 一次 TaskGraph 執行的量測結果
+// - criticalPath：依實測時間計算、最長的一條依賴鏈
+// - utilization ：work / (makespan × 參與執行緒數)
+struct GraphRunStats
+{
+    std::chrono::nanoseconds makespan{0};
+    std::chrono::nanoseconds criticalPath{0};
+    std::chrono::nanoseconds work{0};
+    size_t participants = 0;
+    double utilization = 0.0;
+
+    // 理論上限：work / criticalPath
+    double parallelism() const
+    {  return criticalPath.count() > 0 ? static_cast<double>(work.count()) / static_cast<double>(criticalPath.count()) : 0.0;  }
+};
+
+// 可重複執行的任務圖：建立一次（節點 + 邊），compile() 驗證並轉成扁平的 CSR 結構後，
+// 以 ThreadPool::run(graph) 執行任意次數
+// - 每次執行只把依賴計數整批重設，不配置記憶體、不建立 shared_ptr
+// - 節點完成時以原子遞減釋放後繼，第一個就緒的後繼由同一條執行緒直接接著執行
+// - 就緒節點依「到終點的最長剩餘路徑」排序：同一條執行緒接著跑關鍵路徑，其餘依序派送；
+//   路徑長度先用 setCostHint() 的估計，之後每次執行以實測時間更新
+// - 同一個 TaskGraph 同一時間只能有一次執行；修改節點或邊後須重新 compile()
+class TaskGraph
+{
+public:
+    using NodeId = size_t;
+    static constexpr NodeId npos = std::numeric_limits<NodeId>::max();
+
+    // 交給 Scheduler 的函式，由 ThreadPool 提供（ctx 為 ThreadPool 本身）
+    // 沒有放入佇列的任務留在 span 中，由 TaskGraph 就地執行
+    using Dispatch = void (*)(void* ctx, std::span<Task> tasks);
+
+    TaskGraph() = default;
+    TaskGraph(const TaskGraph&) = delete;
+    TaskGraph& operator=(const TaskGraph&) = delete;
+
+    // 節點的任務每次執行都會被呼叫，因此不可在呼叫後失效
+    NodeId addNode(Task task, std::string name = {});
+
+    // before 完成後 after 才能開始
+    void precede(NodeId before, NodeId after);
+
+    // 尚未有實測時間前使用的執行時間估計（預設 1us）
+    void setCostHint(NodeId id, std::chrono::nanoseconds cost);
+
+    // 檢查節點編號與循環依賴並建立執行用的結構；失敗時記錄錯誤並回傳 false
+    bool compile();
+
+    bool compiled() const { return compiled_; }
+    size_t nodeCount() const { return nodes_.size(); }
+    size_t edgeCount() const { return edges_.size(); }
+    const std::string& nodeName(NodeId id) const { return nodes_.at(id).name; }
+
+    // 最近一次執行的量測結果（執行中呼叫時為上一次的結果）
+    const GraphRunStats& lastRun() const { return lastRun_; }
+
+    // 執行一次並等到所有節點完成，呼叫端也會執行節點；重新拋出第一個節點例外
+    // workers 為 pool 的工作執行緒數（用於計算使用率）；通常透過 ThreadPool::run(graph) 呼叫
+    void execute(void* ctx, Dispatch dispatch, size_t workers = 0);
+
+private:
+    struct Node
+    {
+        Task task;
+        std::string name;
+        double estimateNs = 1000.0;   // 估計或實測（指數平滑）的執行時間
+        bool measured = false;
+    };
+
+    void ensureIdle() const;
+    void runNode(NodeId id);
+    Task nodeTask(NodeId id);
+    void dispatchNode(NodeId id);
+    void finishOne();
+    void updateRanks();
+    void collectStats(int64_t beginNs, size_t participants);
+
+    std::vector<Node> nodes_;
+    std::vector<std::pair<NodeId, NodeId>> edges_;
+    bool compiled_ = false;
+
+    // compile() 產生：succOffsets_[i] .. succOffsets_[i + 1] 為 i 的後繼在 successors_ 中的範圍
+    std::vector<size_t> succOffsets_;
+    std::vector<NodeId> successors_;     // 每段依 rank_ 由大到小排序
+    std::vector<int> initialPending_;
+    std::vector<NodeId> roots_;          // 依 rank_ 由大到小排序
+    std::vector<NodeId> topoOrder_;
+    std::vector<double> rank_;           // 到終點的最長剩餘路徑（估計，奈秒）
+    std::unique_ptr<std::atomic<int>[]> pending_;
+    std::vector<Task> rootTasks_;   // 保留容量，每次執行重複使用
+
+    // 每次執行的量測：durationNs_ 為節點實測時間，pathNs_ 為以該節點結尾的最長實測路徑
+    std::unique_ptr<int64_t[]> durationNs_;
+    std::unique_ptr<std::atomic<int64_t>[]> pathNs_;
+    GraphRunStats lastRun_;
+
+    // 執行期狀態
+    std::atomic<bool> running_{false};
+    std::atomic<size_t> remaining_{0};
+    std::atomic<bool> failed_{false};
+    std::exception_ptr error_;
+    void* ctx_ = nullptr;
+    Dispatch dispatch_ = nullptr;
+
+    std::mutex doneMutex_;
+    std::condition_variable doneCv_;
+    bool done_ = false;
+};
+
+} // namespace ConcurrentEngine::Scheduler
+
+#endif // CONCURRENTENGINE_SCHEDULER_TASKGRAPH_HPP
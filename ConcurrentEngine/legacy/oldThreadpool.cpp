@@ -1,10 +1,14 @@
-#include <threadPool/threadPool.hpp>
+#include "oldThreadpool.hpp"
 #include <threadPool/logger/threadLogger.hpp>
 #include <threadPool/core/threadMeta.hpp>
 #include <iostream>
 #include <chrono>
 
-#if 0
+#ifdef CE_BUILD_LEGACY_POOL
+
+namespace ConcurrentEngine::Legacy
+{
+
 // before
 ThreadPool::ThreadPool() : state_(std::make_shared<ThreadPoolState>()) {}
 
@@ -50,7 +54,7 @@ void ThreadPool::createWorkerThread()
     );
     meta->thread->start();
 
-    ThreadLogger::getInstance().log("[ThreadPool] Thread started", tid);
+    LOG_INFO_T(tid, "[ThreadPool] Thread started");
 }
 
 void ThreadPool::start() 
@@ -97,8 +101,11 @@ void ThreadPool::stop()
 
         for (auto& [id, meta] : threadMetas_) 
             metas.push_back(meta);
+        for (auto& meta : retiredMetas_)
+            metas.push_back(meta);
 
         threadMetas_.clear();
+        retiredMetas_.clear();
     }
 
     for (auto& meta : metas) 
@@ -208,8 +215,11 @@ void ThreadPool::threadFunc(int threadid)
         std::lock_guard<std::mutex> lock(state_->threadMapMutex);
         std::cout << "[ThreadPool] threadfunc() get lock state_->threadMapMutex\n";
         threadMetas_.erase(threadid);
+        retiredMetas_.push_back(meta); // 最後一個參考若在本執行緒釋放，~Thread 會 join 自己
         meta->markTerminated();
     }
 }
 
-#endif
\ No newline at end of file
+} // namespace ConcurrentEngine::Legacy
+
+#endif // CE_BUILD_LEGACY_POOL
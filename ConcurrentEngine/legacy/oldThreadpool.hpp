@@ -1,5 +1,5 @@
-#ifndef THREAD_POOL_HPP
-#define THREAD_POOL_HPP
+#ifndef CONCURRENTENGINE_LEGACY_OLDTHREADPOOL_HPP
+#define CONCURRENTENGINE_LEGACY_OLDTHREADPOOL_HPP
 
 #include <unordered_map>
 #include <queue>
@@ -8,11 +8,17 @@
 #include <memory>
 #include <functional>
 #include <future>
-#include <threadpool/core/thread.hpp>
+#include <threadPool/core/thread.hpp>
 #include <threadPool/core/threadMeta.hpp>
+#include <threadPool/basicThreadPool.hpp>
 
+// 舊版 ThreadPool（單一 std::queue + 條件變數），只保留作為 ce_bench 的比較基準
+// 以 -DCE_BUILD_LEGACY_POOL 編譯，放在 ConcurrentEngine::Legacy 避免與目前的 ThreadPool 衝突
+#ifdef CE_BUILD_LEGACY_POOL
+
+namespace ConcurrentEngine::Legacy
+{
 
-#if 0
 // before
 class ThreadPool {
 public:
@@ -56,10 +62,13 @@ private:
 private:
     std::shared_ptr<ThreadPoolState> state_;
     std::unordered_map<int, std::shared_ptr<ThreadMeta>> threadMetas_;
+    std::vector<std::shared_ptr<ThreadMeta>> retiredMetas_;  // 已結束、等待 stop() join 的執行緒
     std::queue<Task> taskQueue_;
 };
-#endif
 
+} // namespace ConcurrentEngine::Legacy
+
+#endif // CE_BUILD_LEGACY_POOL
 
-#endif
+#endif // CONCURRENTENGINE_LEGACY_OLDTHREADPOOL_HPP
 
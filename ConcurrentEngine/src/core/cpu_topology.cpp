@@ -0,0 +1,232 @@
+#include <threadPool/core/cpuTopology.hpp>
+#include <threadPool/logger/threadLogger.hpp>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ConcurrentEngine
+{
+
+namespace
+{
+
+// 目前執行緒綁定的 node（-1 代表未綁定）
+thread_local int tlsNumaNode = -1;
+
+// 解析 "0-3,8-11" 格式的 cpulist
+std::vector<int> parseCpuList(const std::string& text)
+{
+    std::vector<int> result;
+    std::stringstream ss(text);
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+        if (range.empty() || range == "\n") continue;
+        size_t dash = range.find('-');
+        try
+        {
+            int lo = std::stoi(range.substr(0, dash));
+            int hi = dash == std::string::npos ? lo : std::stoi(range.substr(dash + 1));
+            for (int cpu = lo; cpu <= hi; ++cpu)
+                result.push_back(cpu);
+        }
+        catch (const std::exception&)
+        {  return {};  }
+    }
+    return result;
+}
+
+std::vector<int> readCpuList(const std::string& path)
+{
+    std::ifstream in(path);
+    std::string text;
+    if (!in || !std::getline(in, text))
+        return {};
+    return parseCpuList(text);
+}
+
+} // namespace
+
+const CpuTopology& CpuTopology::get()
+{
+    static CpuTopology instance;
+    return instance;
+}
+
+CpuTopology::CpuTopology()
+{
+    cpus_ = readCpuList("/sys/devices/system/cpu/online");
+
+#ifdef __linux__
+    // 只保留行程 affinity mask 允許的 CPU（例如容器或 taskset 限制）
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0)
+    {
+        if (cpus_.empty())
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+                if (CPU_ISSET(cpu, &allowed))
+                    cpus_.push_back(cpu);
+        }
+        else
+        {
+            std::erase_if(cpus_, [&](int cpu) { return cpu >= CPU_SETSIZE || !CPU_ISSET(cpu, &allowed); });
+        }
+    }
+#endif
+
+    if (cpus_.empty())
+    {
+        unsigned n = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned cpu = 0; cpu < n; ++cpu)
+            cpus_.push_back(static_cast<int>(cpu));
+    }
+
+    const int maxCpu = *std::max_element(cpus_.begin(), cpus_.end());
+    cpuNode_.assign(static_cast<size_t>(maxCpu) + 1, 0);
+
+    for (int node : readCpuList("/sys/devices/system/node/online"))
+    {
+        std::vector<int> nodeCpus;
+        for (int cpu : readCpuList("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist"))
+        {
+            if (std::find(cpus_.begin(), cpus_.end(), cpu) != cpus_.end())
+                nodeCpus.push_back(cpu);
+        }
+        if (nodeCpus.empty()) continue;   // 沒有可用 CPU 的 node（純記憶體 node）不列入
+
+        for (int cpu : nodeCpus)
+            cpuNode_[static_cast<size_t>(cpu)] = static_cast<int>(nodeCpus_.size());
+        nodeCpus_.push_back(std::move(nodeCpus));
+    }
+
+    if (nodeCpus_.empty())
+    {
+        nodeCpus_.push_back(cpus_);
+        std::fill(cpuNode_.begin(), cpuNode_.end(), 0);
+    }
+}
+
+const std::vector<int>& CpuTopology::cpusOfNode(int node) const
+{
+    if (node < 0 || static_cast<size_t>(node) >= nodeCpus_.size())
+        return cpus_;
+    return nodeCpus_[static_cast<size_t>(node)];
+}
+
+int CpuTopology::nodeOfCpu(int cpu) const
+{
+    if (cpu < 0 || static_cast<size_t>(cpu) >= cpuNode_.size())
+        return 0;
+    return cpuNode_[static_cast<size_t>(cpu)];
+}
+
+WorkerPlacement resolvePlacement(const PlacementPolicy& policy, size_t index)
+{
+    const CpuTopology& topo = CpuTopology::get();
+    WorkerPlacement placement;
+
+    auto pinTo = [&](int cpu) {
+        placement.cpu = cpu;
+        placement.cpuSet = {cpu};
+        placement.numaNode = topo.nodeOfCpu(cpu);
+    };
+
+    switch (policy.kind)
+    {
+        case PlacementPolicy::Kind::NONE:
+            break;
+
+        case PlacementPolicy::Kind::COMPACT:
+        {
+            std::vector<int> order;
+            for (size_t node = 0; node < topo.nodeCount(); ++node)
+            {
+                const auto& cpus = topo.cpusOfNode(static_cast<int>(node));
+                order.insert(order.end(), cpus.begin(), cpus.end());
+            }
+            pinTo(order[index % order.size()]);
+            break;
+        }
+
+        case PlacementPolicy::Kind::SCATTER:
+        {
+            const size_t nodes = topo.nodeCount();
+            const auto& cpus = topo.cpusOfNode(static_cast<int>(index % nodes));
+            pinTo(cpus[(index / nodes) % cpus.size()]);
+            break;
+        }
+
+        case PlacementPolicy::Kind::EXPLICIT:
+            if (!policy.cpus.empty())
+                pinTo(policy.cpus[index % policy.cpus.size()]);
+            break;
+
+        case PlacementPolicy::Kind::PER_NUMA_NODE:
+        {
+            int node = static_cast<int>(index % topo.nodeCount());
+            placement.numaNode = node;
+            placement.cpuSet = topo.cpusOfNode(node);
+            break;
+        }
+    }
+
+    return placement;
+}
+
+bool applyPlacement(const WorkerPlacement& placement)
+{
+    if (placement.cpuSet.empty())
+        return true;
+
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : placement.cpuSet)
+    {
+        if (cpu >= 0 && cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+
+    int rc = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (rc != 0)
+    {
+        LOG_WARN("[CpuTopology] pthread_setaffinity_np failed (error {}), cpu {} node {}",
+                 rc, placement.cpu, placement.numaNode);
+        return false;
+    }
+
+    tlsNumaNode = placement.numaNode;
+    return true;
+#else
+    LOG_WARN("[CpuTopology] Thread affinity not supported on this platform");
+    return false;
+#endif
+}
+
+int currentNumaNode()
+{
+    if (tlsNumaNode >= 0)
+        return tlsNumaNode;
+
+    const CpuTopology& topo = CpuTopology::get();
+    if (topo.nodeCount() <= 1)
+        return 0;
+
+#ifdef __linux__
+    int cpu = sched_getcpu();
+    return cpu >= 0 ? topo.nodeOfCpu(cpu) : 0;
+#else
+    return 0;
+#endif
+}
+
+} // namespace ConcurrentEngine
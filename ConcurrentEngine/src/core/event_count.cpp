@@ -0,0 +1,89 @@
+#include <threadPool/core/eventCount.hpp>
+#include <algorithm>
+#include <climits>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+namespace ConcurrentEngine
+{
+
+namespace
+{
+
+#ifdef __linux__
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex word must be a plain 32-bit integer");
+
+// timeout 為相對時間（CLOCK_MONOTONIC）；nullptr 代表不限時
+void futexWait(std::atomic<uint32_t>* word, uint32_t expected, const timespec* timeout)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE, expected, timeout, nullptr, 0);
+}
+
+void futexWake(std::atomic<uint32_t>* word, int count)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+#endif
+
+} // namespace
+
+void EventCount::wait(Key key) noexcept
+{
+    while (epoch_.load(std::memory_order_acquire) == key.epoch_)
+    {
+#ifdef __linux__
+        futexWait(&epoch_, key.epoch_, nullptr);
+#else
+        epoch_.wait(key.epoch_, std::memory_order_acquire);
+#endif
+    }
+    cancelWait();
+}
+
+bool EventCount::waitUntil(Key key, Clock::time_point deadline) noexcept
+{
+    bool notified = true;
+    while (epoch_.load(std::memory_order_acquire) == key.epoch_)
+    {
+        const auto remaining = deadline - Clock::now();
+        if (remaining <= Clock::duration::zero())
+        {
+            notified = false;
+            break;
+        }
+
+#ifdef __linux__
+        const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+        timespec timeout{static_cast<time_t>(ns / 1000000000), static_cast<long>(ns % 1000000000)};
+        futexWait(&epoch_, key.epoch_, &timeout);
+#else
+        // std::atomic::wait 沒有逾時版本，以短暫睡眠輪詢
+        std::this_thread::sleep_for(std::min<Clock::duration>(remaining, std::chrono::milliseconds(1)));
+#endif
+    }
+    cancelWait();
+    return notified;
+}
+
+void EventCount::wake(size_t count) noexcept
+{
+    epoch_.fetch_add(1, std::memory_order_acq_rel);
+#ifdef __linux__
+    futexWake(&epoch_, static_cast<int>(std::min<size_t>(count, INT_MAX)));
+#else
+    if (count == 1)
+        epoch_.notify_one();
+    else
+        epoch_.notify_all();
+#endif
+}
+
+} // namespace ConcurrentEngine
@@ -34,15 +34,14 @@ void Thread::start()
 
 void Thread::run()
 {
-    ThreadLogger::getInstance().log("RUN", LogLevel::INFO, threadID_);
+    LOG_INFO_T(threadID_, "RUN");
     while (true)
     {
         ThreadFunc task;
         {
             std::unique_lock<std::mutex> lock(mutex_);
-            ThreadLogger::getInstance().log(
-                "Waiting for task or stop signal, hasTask = " + std::to_string(hasTask_) + ", stopFlag = " + std::to_string(stopFlag_)
-                , LogLevel::INFO, threadID_);
+            LOG_INFO_T(threadID_, "Waiting for task or stop signal, hasTask = {}, stopFlag = {}",
+                       static_cast<int>(hasTask_), static_cast<int>(stopFlag_));
             condVar_.wait(lock, [this]() { return hasTask_ || stopFlag_; });
 
             if (stopFlag_ && !hasTask_)
@@ -50,7 +49,7 @@ void Thread::run()
 
             task = std::move(task_);
             hasTask_ = false;
-            ThreadLogger::getInstance().log("Executing task", LogLevel::INFO, threadID_);
+            LOG_INFO_T(threadID_, "Executing task");
         }
 
         if (task)
@@ -58,7 +57,7 @@ void Thread::run()
             
         if (stopFlag_ && !hasTask_) 
         {
-            ThreadLogger::getInstance().log("Stopping thread", LogLevel::INFO, threadID_);
+            LOG_INFO_T(threadID_, "Stopping thread");
             break;
         }   
     }
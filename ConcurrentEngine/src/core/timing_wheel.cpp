@@ -0,0 +1,373 @@
+#include <threadPool/core/timingWheel.hpp>
+#include <threadPool/logger/threadLogger.hpp>
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <stdexcept>
+
+namespace ConcurrentEngine
+{
+
+TimingWheel::TimingWheel(void* ctx, Dispatch dispatch, std::chrono::nanoseconds tick)
+    : ctx_(ctx)
+    , dispatch_(dispatch)
+    , tickNs_(std::max<int64_t>(1, tick.count()))
+    , epoch_(Clock::now())
+{
+    for (auto& level : slots_)
+        level.fill(kNil);
+}
+
+TimingWheel::~TimingWheel()
+{  stop();  }
+
+int64_t TimingWheel::tickAt(Clock::time_point time) const
+{
+    const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch_).count();
+    return ns > 0 ? ns / tickNs_ : 0;
+}
+
+TimingWheel::Clock::time_point TimingWheel::timeOf(int64_t tick) const
+{  return epoch_ + std::chrono::nanoseconds(tick * tickNs_);  }
+
+TimingWheel::TimerId TimingWheel::schedule(Clock::time_point when, TaskFunction task, std::chrono::nanoseconds period)
+{
+    if (!task) return kInvalidTimer;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (!running_)
+    {
+        running_ = true;
+        wakeTick_ = std::numeric_limits<int64_t>::max();
+        thread_ = std::thread(&TimingWheel::run, this);
+    }
+
+    // 輪子是空的時候計時執行緒不推進 tick，先補上經過的時間
+    if (count_ == 0)
+        currentTick_ = std::max(currentTick_, tickAt(Clock::now()));
+
+    // 到期時間無條件進位，保證不會提早執行
+    const int64_t ns = std::chrono::duration_cast<std::chrono::nanoseconds>(when - epoch_).count();
+    const int64_t expiry = std::max(currentTick_ + 1, ns > 0 ? (ns + tickNs_ - 1) / tickNs_ : 0);
+
+    const uint32_t index = allocNode();
+    Node& node = nodes_[index];
+    node.expiry = expiry;
+    if (period.count() > 0)
+    {
+        node.period = std::max<int64_t>(1, (period.count() + tickNs_ - 1) / tickNs_);
+        node.periodic = std::make_shared<Periodic>();
+        node.periodic->body = std::move(task);
+    }
+    else
+    {
+        node.period = 0;
+        node.task = std::move(task);
+    }
+    link(index);
+    ++count_;
+
+    const TimerId id = (static_cast<TimerId>(node.generation) << 32) | (index + 1);
+    const bool wake = expiry < wakeTick_;
+    lock.unlock();
+
+    if (wake)
+        cv_.notify_one();
+    return id;
+}
+
+bool TimingWheel::cancel(TimerId id)
+{
+    const uint64_t low = id & 0xffffffffu;
+    if (low == 0) return false;
+
+    const auto index = static_cast<uint32_t>(low - 1);
+    const auto generation = static_cast<uint32_t>(id >> 32);
+
+    // 任務在鎖外解構
+    TaskFunction task;
+    std::shared_ptr<Periodic> periodic;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (index >= nodes_.size()) return false;
+
+        Node& node = nodes_[index];
+        if (!node.linked || node.generation != generation) return false;
+
+        task = std::move(node.task);
+        periodic = std::move(node.periodic);
+        unlink(index);
+        freeNode(index);
+    }
+    return true;
+}
+
+void TimingWheel::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        running_ = false;
+    }
+    cv_.notify_all();
+    if (thread_.joinable())
+        thread_.join();
+
+    std::vector<TaskFunction> pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (uint32_t i = 0; i < nodes_.size(); ++i)
+        {
+            Node& node = nodes_[i];
+            if (!node.linked) continue;
+            if (node.task)
+                pending.push_back(std::move(node.task));
+            unlink(i);
+            freeNode(i);
+        }
+        for (TaskFunction& task : due_)
+            pending.push_back(std::move(task));
+        due_.clear();
+    }
+
+    if (!pending.empty())
+        LOG_INFO("[TimingWheel] Stopped with {} pending timers", pending.size());
+    failAll(pending, "[TimingWheel] Stopped before the timer fired");
+}
+
+size_t TimingWheel::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return count_;
+}
+
+uint32_t TimingWheel::allocNode()
+{
+    if (freeHead_ != kNil)
+    {
+        const uint32_t index = freeHead_;
+        freeHead_ = nodes_[index].next;
+        return index;
+    }
+    nodes_.emplace_back();
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void TimingWheel::freeNode(uint32_t index)
+{
+    Node& node = nodes_[index];
+    node.task = nullptr;
+    node.periodic.reset();
+    ++node.generation;
+    node.next = freeHead_;
+    freeHead_ = index;
+    --count_;
+}
+
+// 依剩餘的 tick 數決定層級：第 k 層放 delta < 256^(k+1) 的節點，格子由到期 tick 的第 k 組 8 位元決定
+void TimingWheel::link(uint32_t index)
+{
+    Node& node = nodes_[index];
+    const int64_t delta = node.expiry - currentTick_;
+
+    int level = 0;
+    while (level < kLevels - 1 && delta >= (int64_t{1} << (kSlotBits * (level + 1))))
+        ++level;
+
+    // 超出最上層範圍的先放在最遠的格子，下放時再重新計算
+    const int64_t horizon = currentTick_ + (int64_t{1} << (kSlotBits * kLevels)) - 1;
+    const int64_t expiry = std::min(node.expiry, horizon);
+    const auto slot = static_cast<uint16_t>((expiry >> (kSlotBits * level)) & (kSlots - 1));
+
+    uint32_t& head = slots_[level][slot];
+    node.level = static_cast<uint8_t>(level);
+    node.slot = slot;
+    node.prev = kNil;
+    node.next = head;
+    if (head != kNil)
+        nodes_[head].prev = index;
+    head = index;
+    node.linked = true;
+
+    ++levelCount_[level];
+    if (level == 0)
+        level0Bits_[slot >> 6] |= uint64_t{1} << (slot & 63);
+}
+
+void TimingWheel::unlink(uint32_t index)
+{
+    Node& node = nodes_[index];
+    if (node.prev != kNil)
+        nodes_[node.prev].next = node.next;
+    else
+        slots_[node.level][node.slot] = node.next;
+    if (node.next != kNil)
+        nodes_[node.next].prev = node.prev;
+
+    node.prev = node.next = kNil;
+    node.linked = false;
+
+    --levelCount_[node.level];
+    if (node.level == 0 && slots_[0][node.slot] == kNil)
+        level0Bits_[node.slot >> 6] &= ~(uint64_t{1} << (node.slot & 63));
+}
+
+// 把第 level 層目前指到的格子重新分配到較低層
+void TimingWheel::cascade(int level)
+{
+    const auto slot = static_cast<size_t>((currentTick_ >> (kSlotBits * level)) & (kSlots - 1));
+    uint32_t index = slots_[level][slot];
+    while (index != kNil)
+    {
+        const uint32_t next = nodes_[index].next;
+        unlink(index);
+        link(index);
+        index = next;
+    }
+}
+
+void TimingWheel::advanceTo(int64_t tick)
+{
+    while (currentTick_ < tick)
+    {
+        ++currentTick_;
+
+        // 第 0 層轉完一圈時由高到低下放；高層的格子只有在下一層也轉完一圈時才需要處理
+        if ((currentTick_ & (kSlots - 1)) == 0)
+        {
+            int top = 1;
+            while (top < kLevels - 1 && ((currentTick_ >> (kSlotBits * top)) & (kSlots - 1)) == 0)
+                ++top;
+            for (int level = top; level >= 1; --level)
+            {
+                if (levelCount_[level] > 0)
+                    cascade(level);
+            }
+        }
+
+        const auto slot = static_cast<size_t>(currentTick_ & (kSlots - 1));
+        uint32_t index = slots_[0][slot];
+        while (index != kNil)
+        {
+            const uint32_t next = nodes_[index].next;
+            unlink(index);
+            expire(index);
+            index = next;
+        }
+
+        if (count_ == 0)
+        {
+            currentTick_ = tick;
+            break;
+        }
+    }
+}
+
+// 呼叫端須持有 mutex_ 且節點已從格子上移除
+void TimingWheel::expire(uint32_t index)
+{
+    Node& node = nodes_[index];
+    if (node.period == 0)
+    {
+        due_.push_back(std::move(node.task));
+        freeNode(index);
+        return;
+    }
+
+    if (!node.periodic->running.exchange(true, std::memory_order_acq_rel))
+        due_.emplace_back(PeriodicRun(node.periodic));
+    else
+        LOG_DEBUG("[TimingWheel] Periodic timer skipped, previous run still in progress");
+
+    // 固定速率；落後超過一個週期時跳過錯過的次數
+    node.expiry += node.period;
+    if (node.expiry <= currentTick_)
+        node.expiry += ((currentTick_ - node.expiry) / node.period + 1) * node.period;
+    link(index);
+}
+
+// 第 0 層下一個非空的格子，與下一次需要下放的時間取早者
+int64_t TimingWheel::nextWakeTick() const
+{
+    int64_t wake = std::numeric_limits<int64_t>::max();
+
+    if (levelCount_[0] > 0)
+    {
+        const size_t current = static_cast<size_t>(currentTick_ & (kSlots - 1));
+        auto findFrom = [this](size_t start) -> int {
+            for (size_t word = start / 64; word < level0Bits_.size(); ++word)
+            {
+                uint64_t bits = level0Bits_[word];
+                if (word == start / 64)
+                    bits &= ~uint64_t{0} << (start % 64);
+                if (bits != 0)
+                    return static_cast<int>(word * 64) + std::countr_zero(bits);
+            }
+            return -1;
+        };
+
+        int slot = findFrom((current + 1) & (kSlots - 1));
+        if (slot < 0)
+            slot = findFrom(0);
+        if (slot >= 0)
+            wake = currentTick_ + static_cast<int64_t>((static_cast<size_t>(slot) - current) & (kSlots - 1));
+    }
+
+    for (int level = 1; level < kLevels; ++level)
+    {
+        if (levelCount_[level] > 0)
+        {
+            wake = std::min(wake, ((currentTick_ >> kSlotBits) + 1) << kSlotBits);
+            break;
+        }
+    }
+    return wake;
+}
+
+void TimingWheel::failAll(std::vector<TaskFunction>& tasks, const char* reason)
+{
+    for (TaskFunction& task : tasks)
+    {
+        if (task)
+            task.fail(std::make_exception_ptr(std::runtime_error(reason)));
+    }
+}
+
+void TimingWheel::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (running_)
+    {
+        const int64_t now = tickAt(Clock::now());
+        if (now > currentTick_)
+            advanceTo(now);
+
+        if (!due_.empty())
+        {
+            // 交給 Scheduler 時不持有鎖，dispatch 可能因 BLOCK 策略而等待
+            dispatching_.swap(due_);
+            wakeTick_ = currentTick_ + 1;
+            lock.unlock();
+
+            try
+            {  dispatch_(ctx_, std::span<TaskFunction>(dispatching_));  }
+            catch (const std::exception& e)
+            {  LOG_WARN("[TimingWheel] Dispatch failed: {}", e.what());  }
+
+            failAll(dispatching_, "[TimingWheel] Timer task rejected by the scheduler");
+            dispatching_.clear();
+
+            lock.lock();
+            continue;
+        }
+
+        wakeTick_ = count_ > 0 ? nextWakeTick() : std::numeric_limits<int64_t>::max();
+        if (wakeTick_ == std::numeric_limits<int64_t>::max())
+            cv_.wait(lock, [this] { return !running_ || count_ > 0; });
+        else
+            cv_.wait_until(lock, timeOf(wakeTick_));
+    }
+}
+
+} // namespace ConcurrentEngine
@@ -1,30 +1,245 @@
 #include <threadPool/logger/threadLogger.hpp>
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include <thread>
 
-ThreadLogger& ThreadLogger::getInstance() 
+// thread_local 持有者：執行緒結束時標記 ring 為 orphaned，由背景執行緒在清空後回收
+struct ThreadLogger::RingHandle
+{
+    std::shared_ptr<LogRing> ring;
+
+    ~RingHandle()
+    {
+        if (ring)
+            ring->orphaned.store(true, std::memory_order_release);
+    }
+};
+
+ThreadLogger& ThreadLogger::getInstance()
 {
     static ThreadLogger instance;
     return instance;
 }
 
-void ThreadLogger::log(const std::string& message, LogLevel level, int threadID) 
+ThreadLogger::ThreadLogger()
+    : writer_(&ThreadLogger::writerLoop, this)
+{}
+
+ThreadLogger::~ThreadLogger()
+{
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        stopping_ = true;
+    }
+    wakeCv_.notify_one();
+
+    if (writer_.joinable())
+        writer_.join();
+}
+
+ThreadLogger::LogRing& ThreadLogger::localRing()
+{
+    thread_local RingHandle handle;
+    if (!handle.ring)
+    {
+        handle.ring = std::make_shared<LogRing>();
+        std::lock_guard<std::mutex> lock(registryMutex_);
+        rings_.push_back(handle.ring);
+    }
+    return *handle.ring;
+}
+
+void ThreadLogger::log(std::string_view message, LogLevel level, int threadID)
 {
     static thread_local bool reentry = false;
     if (reentry) return;  // 防止遞迴 log 導致 terminate
     reentry = true;
 
-    try 
+    try
+    {
+        LogRing& ring = localRing();
+
+        size_t tail = ring.tail.load(std::memory_order_relaxed);
+        while (tail - ring.head.load(std::memory_order_acquire) >= kRingCapacity)
+        {
+            if (overflowPolicy_.load(std::memory_order_relaxed) == LogOverflowPolicy::DROP)
+            {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                reentry = false;
+                return;
+            }
+            wakeWriter();
+            std::this_thread::yield();
+        }
+
+        LogRecord& record = ring.records[tail & (kRingCapacity - 1)];
+        record.time = std::chrono::steady_clock::now();
+        record.level = level;
+        record.threadID = threadID;
+        record.length = static_cast<uint32_t>(std::min(message.size(), kMaxMessageLength));
+        std::memcpy(record.text, message.data(), record.length);
+        if (message.size() > kMaxMessageLength)
+            std::memcpy(record.text + kMaxMessageLength - 3, "...", 3);
+
+        ring.tail.store(tail + 1, std::memory_order_release);
+        wakeWriter();
+    }
+    catch (...)
+    {  std::fputs("[ThreadLogger] Logging failed due to exception.\n", stderr);  }
+
+    reentry = false;
+}
+
+void ThreadLogger::wakeWriter()
+{
+    // 與 writerLoop 的 fence 配對；背景執行緒忙碌時不取鎖
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (!writerIdle_.load(std::memory_order_relaxed))
+        return;
+
+    std::lock_guard<std::mutex> lock(wakeMutex_);
+    wakeCv_.notify_one();
+}
+
+void ThreadLogger::flush()
+{
+    if (std::this_thread::get_id() == writer_.get_id())
+        return;
+
+    uint64_t ticket = flushRequested_.fetch_add(1) + 1;
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex_);
+        wakeCv_.notify_one();
+    }
+
+    std::unique_lock<std::mutex> lock(flushMutex_);
+    flushCv_.wait(lock, [this, ticket] { return flushCompleted_ >= ticket; });
+}
+
+void ThreadLogger::setOverflowPolicy(LogOverflowPolicy policy)
+{  overflowPolicy_ = policy;  }
+
+size_t ThreadLogger::droppedCount() const
+{  return dropped_.load(std::memory_order_relaxed);  }
+
+void ThreadLogger::writerLoop()
+{
+    std::vector<LogRecord> batch;
+    batch.reserve(kRingCapacity);
+
+    while (true)
+    {
+        uint64_t ticket = flushRequested_.load(std::memory_order_acquire);
+        bool stopping = stopping_.load(std::memory_order_acquire);
+
+        batch.clear();
+        size_t count = drain(batch);
+        if (count > 0)
+            writeBatch(batch);
+
+        size_t dropped = dropped_.load(std::memory_order_relaxed);
+        if (dropped != droppedReported_)
+        {
+            std::fprintf(stderr, "[ThreadLogger] %zu log records dropped (ring buffer full)\n",
+                         dropped - droppedReported_);
+            droppedReported_ = dropped;
+        }
+
+        if (ticket > flushCompleted_)
+        {
+            std::fflush(stdout);
+            {
+                std::lock_guard<std::mutex> fileLock(logMutex_);
+                if (logToFile_ && logFile_.is_open())
+                    logFile_.flush();
+            }
+            {
+                std::lock_guard<std::mutex> lock(flushMutex_);
+                flushCompleted_ = ticket;
+            }
+            flushCv_.notify_all();
+        }
+
+        if (count > 0)
+            continue;
+
+        if (stopping)
+            break;
+
+        std::unique_lock<std::mutex> lock(wakeMutex_);
+        writerIdle_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (!hasPending() && !stopping_.load() && flushRequested_.load() == ticket)
+            wakeCv_.wait_for(lock, std::chrono::milliseconds(100));
+        writerIdle_.store(false, std::memory_order_relaxed);
+    }
+
+    std::fflush(stdout);
+    {
+        std::lock_guard<std::mutex> lock(flushMutex_);
+        flushCompleted_ = flushRequested_.load();
+    }
+    flushCv_.notify_all();
+}
+
+size_t ThreadLogger::drain(std::vector<LogRecord>& batch)
+{
+    std::lock_guard<std::mutex> lock(registryMutex_);
+
+    for (auto it = rings_.begin(); it != rings_.end();)
+    {
+        LogRing& ring = **it;
+        bool orphaned = ring.orphaned.load(std::memory_order_acquire);
+        size_t head = ring.head.load(std::memory_order_relaxed);
+        size_t tail = ring.tail.load(std::memory_order_acquire);
+
+        for (; head != tail; ++head)
+            batch.push_back(ring.records[head & (kRingCapacity - 1)]);
+        ring.head.store(head, std::memory_order_release);
+
+        // 擁有者已結束且已清空，回收 ring
+        if (orphaned)
+            it = rings_.erase(it);
+        else
+            ++it;
+    }
+
+    // 各執行緒內的順序保持不變，跨執行緒依時間排序
+    std::stable_sort(batch.begin(), batch.end(),
+                     [](const LogRecord& a, const LogRecord& b) { return a.time < b.time; });
+    return batch.size();
+}
+
+bool ThreadLogger::hasPending()
+{
+    std::lock_guard<std::mutex> lock(registryMutex_);
+    for (const auto& ring : rings_)
     {
-        std::lock_guard<std::mutex> lock(logMutex_);
+        if (ring->tail.load(std::memory_order_seq_cst) != ring->head.load(std::memory_order_relaxed))
+            return true;
+    }
+    return false;
+}
+
+void ThreadLogger::writeBatch(std::vector<LogRecord>& batch)
+{
+    std::string console;
+    std::string plain;
+    console.reserve(batch.size() * 128);
 
-        std::string timestamp = getTimestamp();
-        std::string levelStr;
-        std::string color = getColorPrefix(level);
+    std::lock_guard<std::mutex> lock(logMutex_);
+    bool toFile = logToFile_ && logFile_.is_open();
 
-        switch (level) 
+    for (const LogRecord& record : batch)
+    {
+        const char* levelStr = "";
+        switch (record.level)
         {
             case LogLevel::INFO:  levelStr = "INFO";  break;
             case LogLevel::WARN:  levelStr = "WARN";  break;
@@ -32,57 +247,61 @@ void ThreadLogger::log(const std::string& message, LogLevel level, int threadID)
             case LogLevel::DEBUG: levelStr = "DEBUG"; break;
         }
 
-        std::ostringstream finalMsg;
-        finalMsg << "[" << timestamp << "] [" << levelStr << "] ";
-        if (threadID == -1)
-            finalMsg <<"";
-        else
-            finalMsg << "Thread " << threadID << ": ";
-        finalMsg << message;
+        plain.clear();
+        plain += '[';
+        plain += getTimestamp(wallBase_ + std::chrono::duration_cast<std::chrono::system_clock::duration>(record.time - steadyBase_));
+        plain += "] [";
+        plain += levelStr;
+        plain += "] ";
+        if (record.threadID != -1)
+        {
+            plain += "Thread ";
+            plain += std::to_string(record.threadID);
+            plain += ": ";
+        }
+        plain.append(record.text, record.length);
 
-        // 安全輸出到 console
-        std::fputs((color + finalMsg.str() + "\033[0m\n").c_str(), stdout);
-        std::fflush(stdout); // 確保同步輸出
+        console += getColorPrefix(record.level);
+        console += plain;
+        console += "\033[0m\n";
 
         // 寫入 log 檔案（若啟用）
-        if (logToFile_ && logFile_.is_open()) 
-        {
-            logFile_ << finalMsg.str() << std::endl;
-        }
+        if (toFile)
+            logFile_ << plain << '\n';
 
 #ifdef QT_CORE_LIB
-        if (guiLogCallback_) 
-        {
-            QString qmsg = QString::fromStdString(finalMsg.str());
-            guiLogCallback_(qmsg);
-        }
+        if (guiLogCallback_)
+            guiLogCallback_(QString::fromStdString(plain));
 #endif
+    }
 
-    } catch (...) 
-    {  std::fputs("[ThreadLogger] Logging failed due to exception.\n", stderr);  }
-
-    reentry = false;
+    std::fwrite(console.data(), 1, console.size(), stdout);
+    std::fflush(stdout);
 }
 
-void ThreadLogger::enableFileLogging(const std::string& filename) 
+void ThreadLogger::enableFileLogging(const std::string& filename)
 {
     std::lock_guard<std::mutex> lock(logMutex_);
     logFile_.open(filename, std::ios::out | std::ios::app);
     logToFile_ = logFile_.is_open();
 }
 
-void ThreadLogger::disableFileLogging() 
+void ThreadLogger::disableFileLogging()
 {
+    flush();
     std::lock_guard<std::mutex> lock(logMutex_);
     if (logFile_.is_open())
         logFile_.close();
     logToFile_ = false;
 }
 
-std::string ThreadLogger::getTimestamp() 
+std::string ThreadLogger::getTimestamp(std::chrono::system_clock::time_point time)
 {
-    auto now = std::chrono::system_clock::now();
-    std::time_t t = std::chrono::system_clock::to_time_t(now);
+    // 只在背景執行緒呼叫；同一秒內重複使用格式化結果
+    std::time_t t = std::chrono::system_clock::to_time_t(time);
+    if (t == cachedSecond_)
+        return cachedTimestamp_;
+
     std::tm local_tm;
 #ifdef _WIN32
     localtime_s(&local_tm, &t);
@@ -91,12 +310,15 @@ std::string ThreadLogger::getTimestamp()
 #endif
     std::ostringstream ss;
     ss << std::put_time(&local_tm, "%Y-%m-%d %H:%M:%S");
-    return ss.str();
+
+    cachedSecond_ = t;
+    cachedTimestamp_ = ss.str();
+    return cachedTimestamp_;
 }
 
-std::string ThreadLogger::getColorPrefix(LogLevel level) 
+std::string ThreadLogger::getColorPrefix(LogLevel level)
 {
-    switch (level) 
+    switch (level)
     {
         case LogLevel::INFO:  return "\033[32m"; // green
         case LogLevel::WARN:  return "\033[33m"; // yellow
@@ -107,10 +329,9 @@ std::string ThreadLogger::getColorPrefix(LogLevel level)
 }
 
 #ifdef QT_CORE_LIB
-void ThreadLogger::setGuiLogCallback(std::function<void(const QString&)> callback) 
+void ThreadLogger::setGuiLogCallback(std::function<void(const QString&)> callback)
 {
     std::lock_guard<std::mutex> lock(logMutex_);
     guiLogCallback_ = std::move(callback);
 }
 #endif
-
@@ -1,43 +1,229 @@
 #include <threadPool/scheduler/DAGschedule.hpp>
+#include <algorithm>
 
 namespace ConcurrentEngine::Scheduler
 {
 
-void DAGScheduler::addTask(Task task)// 單純不支援以普通 Task 方式加入，這是 DAG 特殊版本
-{  std::cout << "[DAGScheduler] addTask(Task) not supported.\n";  }
+void DAGScheduler::addTask(Task task)
+{
+    if (!task) return;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        readyTasks_.push(std::move(task));
+        syncReadyCount();
+    }
+    idle_.notify();
+}
+
+void DAGScheduler::addTasks(std::span<Task> tasks)
+{
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Task& task : tasks)
+        {
+            if (!task) continue;
+            readyTasks_.push(std::move(task));
+            ++count;
+        }
+        syncReadyCount();
+    }
+
+    if (count > 0)
+        idle_.notify(count);
+}
 
-void DAGScheduler::addTask(std::shared_ptr<TaskNode> node,
-                           const std::vector<std::shared_ptr<TaskNode>>& dependencies)
+bool DAGScheduler::addTask(std::shared_ptr<TaskNode> node,
+                           const std::vector<std::shared_ptr<TaskNode>>& dependencies,
+                           DAGHandle group)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
+    std::lock_guard<std::mutex> submitLock(submitMutex_);
+
+    if (createsCycle(node, dependencies))
+    {
+        LOG_ERROR("[DAGScheduler] Cycle detected, node rejected");
+        return false;
+    }
+
+    if (group && !group->add())
+    {
+        LOG_ERROR("[DAGScheduler] Completion group already sealed, node rejected");
+        return false;
+    }
+    node->group = std::move(group);
+    propagateRank(node, dependencies);
 
-    // 設定依賴數量
-    node->dependencyCount = static_cast<int>(dependencies.size());
+    // 多算 1 當作保護，避免依賴在登記途中完成而讓計數提早歸零
+    node->dependencyCount.store(static_cast<int>(dependencies.size()) + 1, std::memory_order_relaxed);
 
-    // 將自己加入各依賴節點的 dependents 清單中
+    // 已完成（或為空）的依賴不需等待，最後一併扣除
+    int satisfied = 1;
     for (const auto& dep : dependencies)
     {
-        if (dep)
+        if (!dep)
+        {
+            ++satisfied;
+            continue;
+        }
+
+        std::lock_guard<std::mutex> lock(dep->dependentsMutex);
+        if (dep->completed)
+        {
+            ++satisfied;
+            if (dep->skipped)
+                node->upstreamCancelled.store(true, std::memory_order_relaxed);
+        }
+        else
             dep->dependents.push_back(node);
     }
 
-    // 若無依賴，直接放入 readyQueue
-    if (node->dependencyCount == 0)
+    if (node->dependencyCount.fetch_sub(satisfied, std::memory_order_acq_rel) == satisfied)
+        pushReady(std::move(node));
+    return true;
+}
+
+// 新的邊是 dependency -> node；若從 node 沿著 dependents 能走到任何一個 dependency，就會形成循環
+// 已完成的節點沒有 dependents，因此只會走訪仍在等待的部分
+bool DAGScheduler::createsCycle(const std::shared_ptr<TaskNode>& node,
+                                const std::vector<std::shared_ptr<TaskNode>>& dependencies) const
+{
+    auto isDependency = [&](const TaskNode* candidate) {
+        for (const auto& dep : dependencies)
+        {
+            if (dep.get() == candidate)
+                return true;
+        }
+        return false;
+    };
+
+    if (isDependency(node.get())) return true;
+
+    std::vector<std::shared_ptr<TaskNode>> stack{node};
+    std::vector<const TaskNode*> visited{node.get()};
+    while (!stack.empty())
     {
-        readyQueue_.push(node);
-        cv_.notify_one();
+        auto current = std::move(stack.back());
+        stack.pop_back();
+
+        std::lock_guard<std::mutex> lock(current->dependentsMutex);
+        for (const auto& next : current->dependents)
+        {
+            if (isDependency(next.get())) return true;
+            if (std::find(visited.begin(), visited.end(), next.get()) != visited.end()) continue;
+
+            visited.push_back(next.get());
+            stack.push_back(next);
+        }
     }
+    return false;
+}
+
+// 呼叫端須持有 submitMutex_
+// 新節點接在 dependencies 之後，沿著前驅往上更新 rank；已進入就緒佇列的節點不再更新，
+// 某個前驅的 rank 沒有變大時，它的祖先也不會變，就停止往上
+void DAGScheduler::propagateRank(const std::shared_ptr<TaskNode>& node,
+                                 const std::vector<std::shared_ptr<TaskNode>>& dependencies)
+{
+    const double rank = std::max(node->rank.load(std::memory_order_relaxed), node->cost);
+    node->rank.store(rank, std::memory_order_relaxed);
+
+    std::vector<std::pair<TaskNode*, double>> stack;
+    for (const auto& dep : dependencies)
+    {
+        if (!dep) continue;
+        node->predecessors.push_back(dep);
+        stack.emplace_back(dep.get(), rank);
+    }
+
+    while (!stack.empty())
+    {
+        auto [current, childRank] = stack.back();
+        stack.pop_back();
+
+        if (current->released.load(std::memory_order_relaxed)) continue;
+
+        const double candidate = current->cost + childRank;
+        if (candidate <= current->rank.load(std::memory_order_relaxed)) continue;
+        current->rank.store(candidate, std::memory_order_relaxed);
+
+        for (const auto& weak : current->predecessors)
+        {
+            if (auto pred = weak.lock())
+                stack.emplace_back(pred.get(), candidate);
+        }
+    }
+}
+
+void DAGScheduler::pushReady(std::shared_ptr<TaskNode> node)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pushReadyLocked(std::move(node));
+    }
+    idle_.notify();
+}
+
+// 呼叫端須持有 mutex_
+void DAGScheduler::pushReadyLocked(std::shared_ptr<TaskNode> node)
+{
+    node->released.store(true, std::memory_order_relaxed);
+    const double rank = node->rank.load(std::memory_order_relaxed);
+    readyQueue_.push_back({rank, readySeq_++, std::move(node)});
+    std::push_heap(readyQueue_.begin(), readyQueue_.end());
+    syncReadyCount();
+}
+
+// 呼叫端須持有 mutex_ 且 readyQueue_ 非空
+std::shared_ptr<TaskNode> DAGScheduler::popReadyLocked()
+{
+    std::pop_heap(readyQueue_.begin(), readyQueue_.end());
+    auto node = std::move(readyQueue_.back().node);
+    readyQueue_.pop_back();
+    syncReadyCount();
+    return node;
+}
+
+bool DAGScheduler::hasWork() const
+{  return readyCount_.load(std::memory_order_relaxed) > 0 || !running_.load(std::memory_order_relaxed);  }
+
+// 停止後仍會先取完剩下的就緒任務，都空了才回傳 true（task 保持為空）
+bool DAGScheduler::tryTake(Task& task)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!hasReady())
+        return !running_.load(std::memory_order_relaxed);
+
+    task = takeReady();
+    return true;
 }
 
 Task DAGScheduler::getTask()
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    cv_.wait(lock, [this] { return !readyQueue_.empty() || !running_; });
+    Task task;
+    idle_.wait([this] { return hasWork(); }, [&] { return tryTake(task); });
+    return task;
+}
+
+Task DAGScheduler::getTaskFor(std::chrono::milliseconds timeout)
+{
+    Task task;
+    idle_.waitUntil([this] { return hasWork(); }, [&] { return tryTake(task); },
+                    IdleWaiter::Clock::now() + timeout);
+    return task;
+}
+
+// 呼叫端須持有 mutex_ 且 hasReady()
+Task DAGScheduler::takeReady()
+{
+    if (!readyTasks_.empty())
+    {
+        Task task = std::move(readyTasks_.front());
+        readyTasks_.pop();
+        syncReadyCount();
+        return task;
+    }
 
-    if (!running_ && readyQueue_.empty())  return {};
-    
-    auto node = readyQueue_.front();
-    readyQueue_.pop();
+    auto node = popReadyLocked();
 
     if (!node || !node->task)
     {
@@ -45,41 +231,108 @@ Task DAGScheduler::getTask()
         return {};
     }
 
-    // 回傳一個包裝任務：執行實際任務後通知完成
-    return [this, node]() {
-        try 
-        {  node->task();  } 
-        catch (const std::exception& e) 
-        {  LOG_ERROR(std::string("[DAGScheduler] Exception in task: ") + e.what());  }
-        catch (...) 
-        {  LOG_ERROR("[DAGScheduler] Unknown exception in task!");  }
-        taskCompleted(node);
+    // 回傳一個包裝任務：執行節點後釋放後繼，並在同一條執行緒接著執行 rank 最高的就緒後繼
+    return [this, node = std::move(node)]() mutable {
+        while (node)
+        {
+            const int64_t startNs = std::chrono::steady_clock::now().time_since_epoch().count();
+            std::exception_ptr error;
+            const bool cancelled = node->isCancelled();
+            if (cancelled)
+            {
+                // 不執行：節點的 future 與 group 收到 TaskCancelled，後繼在 taskCompleted 一併取消
+                LOG_DEBUG("[DAGScheduler] Node cancelled, skipped");
+                error = std::make_exception_ptr(TaskCancelled{});
+                node->task.fail(error);
+            }
+            else
+            {
+                CancellationScope scope(node->token);
+                try 
+                {  node->task();  } 
+                catch (const std::exception& e) 
+                {
+                    LOG_ERROR("[DAGScheduler] Exception in task: {}", e.what());
+                    error = std::current_exception();
+                }
+                catch (...) 
+                {
+                    LOG_ERROR("[DAGScheduler] Unknown exception in task!");
+                    error = std::current_exception();
+                }
+            }
+
+            // 前驅已把各自的路徑長度寫進 pathNs（在釋放本節點的 fetch_sub 之前）
+            const int64_t duration = std::chrono::steady_clock::now().time_since_epoch().count() - startNs;
+            const int64_t path = node->pathNs.load(std::memory_order_relaxed) + duration;
+
+            // 執行途中被取消的節點（任務自行提早結束）同樣要讓後繼跟著取消
+            const bool skipSuccessors = cancelled || node->isCancelled();
+
+            // 先釋放後繼再通知 group，group 觸發時這個節點已不再被 Scheduler 使用
+            DAGHandle group = std::move(node->group);
+            node = taskCompleted(*node, path, skipSuccessors);
+            if (group)
+                group->finish(std::move(error), duration, path, workers_.load(std::memory_order_relaxed));
+        }
     };
 }
 
-void DAGScheduler::taskCompleted(std::shared_ptr<TaskNode> node)
+// 以原子遞減釋放後繼；回傳 rank 最高的就緒後繼給呼叫端直接執行，其餘才放進 readyQueue_
+// pathNs 為以 node 結尾的最長實測路徑、cancelled 為 node 是否以取消結束，都在遞減之前寫給每個後繼
+std::shared_ptr<TaskNode> DAGScheduler::taskCompleted(TaskNode& node, int64_t pathNs, bool cancelled)
 {
-    std::unique_lock<std::mutex> lock(mutex_);
-    for (auto& weakDep : node->dependents)
+    std::vector<std::shared_ptr<TaskNode>> dependents;
     {
-        if (auto dependent = weakDep.lock())
-        {
-            if (dependent->dependencyCount > 0)
-                dependent->dependencyCount--;
+        std::lock_guard<std::mutex> lock(node.dependentsMutex);
+        node.completed = true;
+        node.skipped = cancelled;
+        dependents.swap(node.dependents);
+    }
 
-            if (dependent->dependencyCount == 0)
-            {
-                readyQueue_.push(dependent);
-                cv_.notify_one();
-            }
+    // 就緒的後繼就地移到 dependents 前段，不另外配置
+    size_t ready = 0;
+    for (auto& dependent : dependents)
+    {
+        int64_t seen = dependent->pathNs.load(std::memory_order_relaxed);
+        while (seen < pathNs && !dependent->pathNs.compare_exchange_weak(seen, pathNs, std::memory_order_relaxed))
+        {}
+        if (cancelled)
+            dependent->upstreamCancelled.store(true, std::memory_order_relaxed);
+
+        if (dependent->dependencyCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            dependents[ready++] = std::move(dependent);
+    }
+    if (ready == 0) return nullptr;
+
+    auto best = std::max_element(dependents.begin(), dependents.begin() + static_cast<std::ptrdiff_t>(ready),
+        [](const auto& a, const auto& b) {
+            return a->rank.load(std::memory_order_relaxed) < b->rank.load(std::memory_order_relaxed);
+        });
+    std::shared_ptr<TaskNode> next = std::move(*best);
+    next->released.store(true, std::memory_order_relaxed);
+
+    const size_t queued = ready - 1;
+    if (queued > 0)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < ready; ++i)
+        {
+            if (dependents[i])
+                pushReadyLocked(std::move(dependents[i]));
         }
     }
+
+    if (queued > 0)
+        idle_.notify(queued);
+
+    return next;
 }
 
 void DAGScheduler::reportStatus()
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    std::cout << "[DAGScheduler] Ready queue size: " << readyQueue_.size() << "\n";
+    std::cout << "[DAGScheduler] Ready queue size: " << readyQueue_.size() + readyTasks_.size() << "\n";
 }
 
 void DAGScheduler::notifyAll()
@@ -88,7 +341,7 @@ void DAGScheduler::notifyAll()
         std::lock_guard<std::mutex> lock(mutex_);
         running_ = false;
     }
-    cv_.notify_all();  
+    idle_.notifyAll();
 }
 
 void DAGScheduler::setRejectPolicy(RejectPolicy)
@@ -100,7 +353,7 @@ void DAGScheduler::setMaxQueueSize(size_t)
 size_t DAGScheduler::size() const
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    return readyQueue_.size();
+    return readyQueue_.size() + readyTasks_.size();
 }
 
 } // namespace ConcurrentEngine::Scheduler
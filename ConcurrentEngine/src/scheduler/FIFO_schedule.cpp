@@ -1,12 +1,65 @@
 #include <threadPool/scheduler/FIFO_schedule.hpp>
+#include <threadPool/core/cpuTopology.hpp>
 
 namespace ConcurrentEngine::Scheduler 
 {
 
+FIFOScheduler::FIFOScheduler()
+    : nodeQueues_(CpuTopology::get().nodeCount())
+{}
+
+// 單一 node 的機器不需要查詢目前 CPU
+size_t FIFOScheduler::localNode() const
+{
+    if (nodeQueues_.size() == 1) return 0;
+    return static_cast<size_t>(currentNumaNode()) % nodeQueues_.size();
+}
+
+void FIFOScheduler::pushLocked(Task&& task, size_t node)
+{
+    nodeQueues_[node].push(std::move(task));
+    queuedCount_.store(queuedCount_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// 先取本地 node 的佇列，空了再依序取其他 node；呼叫端須持有 mutex_ 且 queuedCount_ > 0
+Task FIFOScheduler::popLocked(size_t node)
+{
+    for (size_t i = 0; i < nodeQueues_.size(); ++i)
+    {
+        auto& queue = nodeQueues_[(node + i) % nodeQueues_.size()];
+        if (!queue.empty())
+        {
+            Task task = std::move(queue.front());
+            queue.pop();
+            queuedCount_.store(queuedCount_.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+            return task;
+        }
+    }
+    return {};
+}
+
+bool FIFOScheduler::hasWork() const
+{
+    return queuedCount_.load(std::memory_order_relaxed) > 0 ||
+           !running_.load(std::memory_order_relaxed);
+}
+
+// 停止後仍會先取完剩下的任務，佇列空了才回傳 true（task 保持為空）
+bool FIFOScheduler::tryTake(Task& task)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queuedCount_.load(std::memory_order_relaxed) == 0)
+        return !running_.load(std::memory_order_relaxed);
+
+    task = popLocked(localNode());
+    cvFull_.notify_one();
+    return true;
+}
+
 size_t FIFOScheduler::size() const 
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    return taskQueue_.size();
+    return queuedCount_;
 }
 
 void FIFOScheduler::setRejectPolicy(RejectPolicy policy) 
@@ -28,6 +81,12 @@ void FIFOScheduler::getRejectPolicy() const
         case RejectPolicy::THROW:
             std::cout << "[FIFOScheduler] RejectPolicy THROW\n";
             break;
+        case RejectPolicy::CALLER_RUNS:
+            std::cout << "[FIFOScheduler] RejectPolicy CALLER_RUNS\n";
+            break;
+        case RejectPolicy::DROP_OLDEST:
+            std::cout << "[FIFOScheduler] RejectPolicy DROP_OLDEST\n";
+            break;
     }
 }
 
@@ -36,48 +95,174 @@ void FIFOScheduler::setMaxQueueSize(size_t maxSize)
 
 void FIFOScheduler::addTask(Task task) 
 {
+    const size_t node = localNode();  // 提交者所在的 node
     std::unique_lock<std::mutex> lock(mutex_);
+    Task evicted;
 
-    if (maxQueueSize_ > 0 && taskQueue_.size() >= maxQueueSize_) 
+    if (maxQueueSize_ > 0 && queuedCount_ >= maxQueueSize_) 
     {
         switch (rejectPolicy_) 
         {
             case RejectPolicy::BLOCK:
-                cvFull_.wait(lock, [this] { return taskQueue_.size() < maxQueueSize_; });
+                cvFull_.wait(lock, [this] {
+                    return queuedCount_ < maxQueueSize_ || !running_.load(std::memory_order_relaxed);
+                });
+                if (!running_.load(std::memory_order_relaxed))
+                {
+                    lock.unlock();
+                    detail::rejectTask(task, "[FIFOScheduler] Task rejected (pool stopped)");
+                    return;
+                }
                 break;
             case RejectPolicy::DISCARD:
-                std::cout << "[FIFOScheduler] Task discarded (queue full)\n";
+                lock.unlock();
+                LOG_WARN("[FIFOScheduler] Task discarded (queue full)");
+                detail::rejectTask(task, "[FIFOScheduler] Task discarded (queue full)");
                 return;
             case RejectPolicy::THROW:
-                throw std::runtime_error("[FIFOScheduler] Task rejected (queue full)");
+                throw TaskRejected("[FIFOScheduler] Task rejected (queue full)");
+            case RejectPolicy::CALLER_RUNS:
+                lock.unlock();
+                task();
+                return;
+            case RejectPolicy::DROP_OLDEST:
+                evicted = popLocked(node);
+                break;
         }
     }
 
-    taskQueue_.push(std::move(task));
-    std::cout << "[FIFOScheduler] Task pushed\n";
+    pushLocked(std::move(task), node);
+    LOG_DEBUG("[FIFOScheduler] Task pushed");
 
     lock.unlock();
-    cv_.notify_one();
+    idle_.notify();
+
+    if (evicted)
+        detail::rejectTask(evicted, "[FIFOScheduler] Task evicted (queue full, DROP_OLDEST)");
 }
 
-Task FIFOScheduler::getTask() 
+SubmitStatus FIFOScheduler::tryAddTask(Task& task)
+{
+    const size_t node = localNode();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (maxQueueSize_ > 0 && queuedCount_ >= maxQueueSize_)
+            return SubmitStatus::QUEUE_FULL;
+        pushLocked(std::move(task), node);
+    }
+    idle_.notify();
+    return SubmitStatus::ACCEPTED;
+}
+
+size_t FIFOScheduler::tryAddTasks(std::span<Task> tasks)
 {
+    const size_t node = localNode();
+    size_t accepted = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (; accepted < tasks.size(); ++accepted)
+        {
+            if (maxQueueSize_ > 0 && queuedCount_ >= maxQueueSize_)
+                break;
+            pushLocked(std::move(tasks[accepted]), node);
+        }
+    }
+    if (accepted > 0)
+        idle_.notify(accepted);
+    return accepted;
+}
+
+// 一次取鎖放入整批任務，最後一次喚醒至多 N 個休眠中的工作執行緒
+// THROW 策略為全有或全無：放不下整批時一個都不加入
+// DISCARD / CALLER_RUNS 在佇列滿時停止放入，剩下的任務在鎖外放棄或由呼叫端執行
+void FIFOScheduler::addTasks(std::span<Task> tasks)
+{
+    if (tasks.empty()) return;
+
+    const size_t node = localNode();
     std::unique_lock<std::mutex> lock(mutex_);
-    cv_.wait(lock, [this] { return !taskQueue_.empty() || !running_; });
 
-    if (!running_ && taskQueue_.empty())
-        return {};
+    if (rejectPolicy_ == RejectPolicy::THROW && maxQueueSize_ > 0 &&
+        queuedCount_ + tasks.size() > maxQueueSize_)
+        throw TaskRejected("[FIFOScheduler] Task batch rejected (queue full)");
 
-    Task task = std::move(taskQueue_.front());
-    taskQueue_.pop();
-    cvFull_.notify_one();
+    size_t pushed = 0;
+    size_t accepted = 0;
+    std::vector<Task> evicted;
+
+    for (; accepted < tasks.size(); ++accepted)
+    {
+        if (maxQueueSize_ > 0 && queuedCount_ >= maxQueueSize_)
+        {
+            if (rejectPolicy_ == RejectPolicy::DISCARD || rejectPolicy_ == RejectPolicy::CALLER_RUNS)
+                break;
+
+            if (rejectPolicy_ == RejectPolicy::DROP_OLDEST)
+                evicted.push_back(popLocked(node));
+            else
+            {
+                // BLOCK：先讓工作執行緒消化已放入的任務，再等待空間
+                idle_.notify(pushed);
+                pushed = 0;
+                cvFull_.wait(lock, [this] {
+                    return queuedCount_ < maxQueueSize_ || !running_.load(std::memory_order_relaxed);
+                });
+                if (!running_.load(std::memory_order_relaxed))
+                    break;
+            }
+        }
+
+        pushLocked(std::move(tasks[accepted]), node);
+        ++pushed;
+    }
+
+    const RejectPolicy policy = rejectPolicy_;
+    lock.unlock();
+    idle_.notify(pushed);
+
+    const size_t overflow = tasks.size() - accepted;
+    if (overflow > 0 && policy == RejectPolicy::DISCARD)
+        LOG_WARN("[FIFOScheduler] {} tasks discarded (queue full)", overflow);
+    if (!evicted.empty())
+        LOG_WARN("[FIFOScheduler] {} tasks evicted (queue full, DROP_OLDEST)", evicted.size());
+    LOG_DEBUG("[FIFOScheduler] {} tasks pushed", accepted);
+
+    for (Task& task : evicted)
+        detail::rejectTask(task, "[FIFOScheduler] Task evicted (queue full, DROP_OLDEST)");
+    if (policy == RejectPolicy::BLOCK)
+    {
+        // BLOCK 只有在等待空間時 pool 停止才會剩下任務
+        for (Task& task : tasks.subspan(accepted))
+            detail::rejectTask(task, "[FIFOScheduler] Task rejected (pool stopped)");
+        return;
+    }
+    detail::handleOverflow(policy, tasks.subspan(accepted), "[FIFOScheduler] Task discarded (queue full)");
+}
+
+Task FIFOScheduler::getTask() 
+{
+    Task task;
+    idle_.wait([this] { return hasWork(); }, [&] { return tryTake(task); });
+    return task;
+}
+
+Task FIFOScheduler::getTaskFor(std::chrono::milliseconds timeout)
+{
+    Task task;
+    idle_.waitUntil([this] { return hasWork(); }, [&] { return tryTake(task); },
+                    IdleWaiter::Clock::now() + timeout);
     return task;
 }
 
 void FIFOScheduler::reportStatus() 
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    std::cout << "[FIFOScheduler] Tasks in queue: " << taskQueue_.size() << std::endl;
+    std::cout << "[FIFOScheduler] Tasks in queue: " << queuedCount_ << std::endl;
+    if (nodeQueues_.size() > 1)
+    {
+        for (size_t i = 0; i < nodeQueues_.size(); ++i)
+            std::cout << "  - Node " << i << ": " << nodeQueues_[i].size() << std::endl;
+    }
 }
 
 void FIFOScheduler::notifyAll() 
@@ -86,7 +271,8 @@ void FIFOScheduler::notifyAll()
         std::lock_guard<std::mutex> lock(mutex_);
         running_ = false;
     }
-    cv_.notify_all();
+    idle_.notifyAll();
+    cvFull_.notify_all();   // 等待空間的 BLOCK 生產者放棄任務後返回
 }
 
 } // namespace ConcurrentEngine::Scheduler
@@ -0,0 +1,255 @@
+#include <threadPool/scheduler/LockFreeFIFO_schedule.hpp>
+#include <stdexcept>
+#include <thread>
+#include <threadPool/logger/threadLogger.hpp>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+namespace
+{
+
+constexpr int kSpinRounds = 64;
+
+} // namespace
+
+LockFreeFIFOScheduler::LockFreeFIFOScheduler(size_t capacity)
+    : ring_(std::make_unique<MPMCRingBuffer<Task>>(capacity == 0 ? kDefaultCapacity : capacity))
+{}
+
+size_t LockFreeFIFOScheduler::size() const
+{  return ring_->sizeApprox();  }
+
+void LockFreeFIFOScheduler::setRejectPolicy(RejectPolicy policy)
+{
+    rejectPolicy_ = policy;
+    getRejectPolicy();
+}
+
+void LockFreeFIFOScheduler::getRejectPolicy() const
+{
+    switch (rejectPolicy_.load())
+    {
+        case RejectPolicy::BLOCK:
+            std::cout << "[LockFreeFIFOScheduler] RejectPolicy BLOCK\n";
+            break;
+        case RejectPolicy::DISCARD:
+            std::cout << "[LockFreeFIFOScheduler] RejectPolicy DISCARD\n";
+            break;
+        case RejectPolicy::THROW:
+            std::cout << "[LockFreeFIFOScheduler] RejectPolicy THROW\n";
+            break;
+        case RejectPolicy::CALLER_RUNS:
+            std::cout << "[LockFreeFIFOScheduler] RejectPolicy CALLER_RUNS\n";
+            break;
+        case RejectPolicy::DROP_OLDEST:
+            std::cout << "[LockFreeFIFOScheduler] RejectPolicy DROP_OLDEST\n";
+            break;
+    }
+}
+
+// 工作執行緒會不取鎖地讀取 ring_，啟動後不能再替換
+void LockFreeFIFOScheduler::setMaxQueueSize(size_t maxSize)
+{
+    if (workersStarted_.load(std::memory_order_acquire))
+    {
+        std::cout << "[LockFreeFIFOScheduler] setMaxQueueSize ignored: workers already started\n";
+        return;
+    }
+    if (ring_->sizeApprox() != 0)
+    {
+        std::cout << "[LockFreeFIFOScheduler] setMaxQueueSize ignored: queue not empty\n";
+        return;
+    }
+    ring_ = std::make_unique<MPMCRingBuffer<Task>>(maxSize == 0 ? kDefaultCapacity : maxSize);
+}
+
+void LockFreeFIFOScheduler::addTask(Task task)
+{
+    const RejectPolicy policy = rejectPolicy_.load(std::memory_order_relaxed);
+    if (enqueue(task, policy))
+    {
+        idle_.notify();
+        return;
+    }
+    if (!task) return;   // BLOCK 等待時 pool 已停止，任務已被放棄
+
+    if (policy == RejectPolicy::THROW)
+        throw TaskRejected("[LockFreeFIFOScheduler] Task rejected (queue full)");
+    detail::handleOverflow(policy, std::span<Task>(&task, 1), "[LockFreeFIFOScheduler] Task discarded (queue full)");
+}
+
+// 逐一放入環形佇列，最後只喚醒一次（最多 N 個消費者）
+// 放不下的任務移到 span 前端，喚醒消費者後才放棄、由呼叫端執行或拋出（THROW 時留在 span 中）
+void LockFreeFIFOScheduler::addTasks(std::span<Task> tasks)
+{
+    if (tasks.empty()) return;
+
+    const RejectPolicy policy = rejectPolicy_.load(std::memory_order_relaxed);
+
+    // 無法預留空間，THROW 只能盡力檢查；之後仍可能有部分任務放不下
+    if (policy == RejectPolicy::THROW && ring_->sizeApprox() + tasks.size() > ring_->capacity())
+        throw TaskRejected("[LockFreeFIFOScheduler] Task batch rejected (queue full)");
+
+    size_t pushed = 0;
+    size_t overflow = 0;
+    for (Task& task : tasks)
+    {
+        if (enqueue(task, policy))
+            ++pushed;
+        else if (task)
+            tasks[overflow++] = std::move(task);
+    }
+
+    if (pushed > 0)
+        idle_.notify(pushed);
+    if (overflow == 0) return;
+
+    if (policy == RejectPolicy::THROW)
+        throw TaskRejected("[LockFreeFIFOScheduler] Task batch partially rejected (queue full)");
+    if (policy == RejectPolicy::DISCARD)
+        LOG_WARN("[LockFreeFIFOScheduler] {} tasks discarded (queue full)", overflow);
+    detail::handleOverflow(policy, tasks.first(overflow), "[LockFreeFIFOScheduler] Task discarded (queue full)");
+}
+
+// 佇列已滿時，BLOCK 等待空間、DROP_OLDEST 擠掉前端後放入；
+// 其他策略回傳 false 並保留 task，由呼叫端在喚醒消費者後處理
+bool LockFreeFIFOScheduler::enqueue(Task& task, RejectPolicy policy)
+{
+    if (ring_->tryPush(task))
+        return true;
+
+    switch (policy)
+    {
+        case RejectPolicy::BLOCK:
+        {
+            // 批次提交時消費者可能尚未被喚醒，先全部叫醒再等待空間
+            idle_.notifyAll();
+
+            // 先自旋，再登記為等待者後重試，最後才睡眠
+            for (int i = 0; i < kSpinRounds; ++i)
+            {
+                std::this_thread::yield();
+                if (ring_->tryPush(task))
+                    return true;
+            }
+
+            while (true)
+            {
+                std::unique_lock<std::mutex> lock(notFull_.mutex);
+                notFull_.count.fetch_add(1);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                notFull_.cv.wait(lock, [this] {
+                    return ring_->sizeApprox() < ring_->capacity() || !running_.load();
+                });
+                notFull_.count.fetch_sub(1);
+                lock.unlock();
+
+                if (!running_.load())
+                {
+                    detail::rejectTask(task, "[LockFreeFIFOScheduler] Task rejected (pool stopped)");
+                    return false;
+                }
+                if (ring_->tryPush(task))
+                    return true;
+            }
+        }
+        case RejectPolicy::DROP_OLDEST:
+        {
+            // 取出佇列前端再放入；兩步之間可能被其他生產者搶走空位，因此重複到放入為止
+            Task oldest;
+            while (!ring_->tryPush(task))
+            {
+                if (ring_->tryPop(oldest))
+                    detail::rejectTask(oldest, "[LockFreeFIFOScheduler] Task evicted (queue full, DROP_OLDEST)");
+            }
+            return true;
+        }
+        case RejectPolicy::DISCARD:
+        case RejectPolicy::THROW:
+        case RejectPolicy::CALLER_RUNS:
+            return false;
+    }
+    return false;
+}
+
+SubmitStatus LockFreeFIFOScheduler::tryAddTask(Task& task)
+{
+    if (!ring_->tryPush(task))
+        return SubmitStatus::QUEUE_FULL;
+    idle_.notify();
+    return SubmitStatus::ACCEPTED;
+}
+
+size_t LockFreeFIFOScheduler::tryAddTasks(std::span<Task> tasks)
+{
+    size_t accepted = 0;
+    while (accepted < tasks.size() && ring_->tryPush(tasks[accepted]))
+        ++accepted;
+    if (accepted > 0)
+        idle_.notify(accepted);
+    return accepted;
+}
+
+// 停止後仍會先取完剩下的任務，佇列空了才回傳 true（task 保持為空）
+bool LockFreeFIFOScheduler::tryTake(Task& task)
+{
+    if (ring_->tryPop(task))
+    {
+        wake(notFull_);
+        return true;
+    }
+    return !running_.load(std::memory_order_relaxed);
+}
+
+Task LockFreeFIFOScheduler::getTask()
+{
+    Task task;
+    idle_.wait([this] { return ring_->sizeApprox() > 0 || !running_.load(std::memory_order_relaxed); },
+               [&] { return tryTake(task); });
+    return task;
+}
+
+Task LockFreeFIFOScheduler::getTaskFor(std::chrono::milliseconds timeout)
+{
+    Task task;
+    idle_.waitUntil([this] { return ring_->sizeApprox() > 0 || !running_.load(std::memory_order_relaxed); },
+                    [&] { return tryTake(task); }, IdleWaiter::Clock::now() + timeout);
+    return task;
+}
+
+void LockFreeFIFOScheduler::wake(Waiters& waiters, size_t count)
+{
+    if (count == 0) return;
+
+    // 與等待端的 fence 配對：任一方必定看到對方的寫入
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int sleeping = waiters.count.load(std::memory_order_relaxed);
+    if (sleeping == 0)
+        return;
+
+    std::lock_guard<std::mutex> lock(waiters.mutex);
+    if (count >= static_cast<size_t>(sleeping))
+        waiters.cv.notify_all();
+    else
+        for (size_t i = 0; i < count; ++i)
+            waiters.cv.notify_one();
+}
+
+void LockFreeFIFOScheduler::reportStatus()
+{
+    std::cout << "[LockFreeFIFOScheduler] Tasks in queue: " << ring_->sizeApprox()
+              << " / " << ring_->capacity() << std::endl;
+}
+
+void LockFreeFIFOScheduler::notifyAll()
+{
+    running_ = false;
+    idle_.notifyAll();
+    {
+        std::lock_guard<std::mutex> lock(notFull_.mutex);
+        notFull_.cv.notify_all();
+    }
+}
+
+} // namespace ConcurrentEngine::Scheduler
@@ -0,0 +1,306 @@
+#include <threadPool/scheduler/EDFScheduler.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+namespace
+{
+
+constexpr int64_t kNoDeadline = std::numeric_limits<int64_t>::max();
+
+int64_t nowNs()
+{  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();  }
+
+int64_t toNs(Deadline deadline)
+{
+    if (deadline == Deadline::max()) return kNoDeadline;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+}
+
+} // namespace
+
+// 呼叫端須持有 mutex_；佇列已滿時依 RejectPolicy 處理
+// DISCARD / CALLER_RUNS 回傳 false，由呼叫端在鎖外處理新任務；DROP_OLDEST 把被放棄的任務放進 evicted
+// BLOCK 等待空間期間 pool 停止時也回傳 false
+bool EDFScheduler::waitForSpace(std::unique_lock<std::mutex>& lock, Task& evicted)
+{
+    if (maxQueueSize_ == 0 || heap_.size() < maxQueueSize_) return true;
+
+    switch (rejectPolicy_)
+    {
+        case RejectPolicy::BLOCK:
+            cvFull_.wait(lock, [this] {
+                return heap_.size() < maxQueueSize_ || !running_.load(std::memory_order_relaxed);
+            });
+            return running_.load(std::memory_order_relaxed);
+        case RejectPolicy::DISCARD:
+        case RejectPolicy::CALLER_RUNS:
+            return false;
+        case RejectPolicy::THROW:
+            throw TaskRejected("[EDFScheduler] Task rejected (queue full)");
+        case RejectPolicy::DROP_OLDEST:
+            evicted = evictLocked();
+            return true;
+    }
+    return true;
+}
+
+// 呼叫端須持有 mutex_ 且 heap_ 非空；DROP_OLDEST 用：取出排在最後的任務（期限最晚，相同時最新）
+// 排在最後的元素必定是葉節點，只需掃描後半段，移除後把補上的元素往上調整即可
+Task EDFScheduler::evictLocked()
+{
+    size_t last = heap_.size() / 2;
+    for (size_t i = last + 1; i < heap_.size(); ++i)
+    {
+        if (heap_[i] < heap_[last])   // operator< 為反向比較：較小者排得較後
+            last = i;
+    }
+
+    Task task = std::move(heap_[last].task);
+    std::swap(heap_[last], heap_.back());
+    heap_.pop_back();
+    if (last < heap_.size())
+        std::push_heap(heap_.begin(), heap_.begin() + static_cast<std::ptrdiff_t>(last) + 1);
+
+    queued_.store(heap_.size(), std::memory_order_relaxed);
+    return task;
+}
+
+void EDFScheduler::pushLocked(Task&& task, int64_t deadlineNs)
+{
+    heap_.push_back({deadlineNs, seq_++, std::move(task)});
+    std::push_heap(heap_.begin(), heap_.end());
+    queued_.store(heap_.size(), std::memory_order_relaxed);
+}
+
+// 呼叫端須持有 mutex_ 且 heap_ 非空
+EDFScheduler::Entry EDFScheduler::popLocked()
+{
+    std::pop_heap(heap_.begin(), heap_.end());
+    Entry entry = std::move(heap_.back());
+    heap_.pop_back();
+    queued_.store(heap_.size(), std::memory_order_relaxed);
+    return entry;
+}
+
+void EDFScheduler::addTask(Task task, Deadline deadline)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    Task evicted;
+
+    if (!waitForSpace(lock, evicted))
+    {
+        const RejectPolicy policy = rejectPolicy_;
+        lock.unlock();
+        if (policy == RejectPolicy::BLOCK)
+            detail::rejectTask(task, "[EDFScheduler] Task rejected (pool stopped)");
+        else
+            detail::handleOverflow(policy, std::span<Task>(&task, 1), "[EDFScheduler] Task discarded (queue full)");
+        return;
+    }
+
+    pushLocked(std::move(task), toNs(deadline));
+    LOG_DEBUG("[EDFScheduler] Task pushed");
+
+    lock.unlock();
+    idle_.notify();
+
+    if (evicted)
+        detail::rejectTask(evicted, "[EDFScheduler] Task evicted (queue full, DROP_OLDEST)");
+}
+
+void EDFScheduler::addTask(Task task)
+{  addTask(std::move(task), Deadline::max());  }
+
+SubmitStatus EDFScheduler::tryAddTask(Task& task, Deadline deadline)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (maxQueueSize_ > 0 && heap_.size() >= maxQueueSize_)
+            return SubmitStatus::QUEUE_FULL;
+        pushLocked(std::move(task), toNs(deadline));
+    }
+    idle_.notify();
+    return SubmitStatus::ACCEPTED;
+}
+
+SubmitStatus EDFScheduler::tryAddTask(Task& task)
+{  return tryAddTask(task, Deadline::max());  }
+
+size_t EDFScheduler::tryAddTasks(std::span<Task> tasks, Deadline deadline)
+{
+    const int64_t deadlineNs = toNs(deadline);
+    size_t accepted = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (; accepted < tasks.size(); ++accepted)
+        {
+            if (maxQueueSize_ > 0 && heap_.size() >= maxQueueSize_)
+                break;
+            pushLocked(std::move(tasks[accepted]), deadlineNs);
+        }
+    }
+    if (accepted > 0)
+        idle_.notify(accepted);
+    return accepted;
+}
+
+size_t EDFScheduler::tryAddTasks(std::span<Task> tasks)
+{  return tryAddTasks(tasks, Deadline::max());  }
+
+// 整批使用同一個期限，只取一次鎖；THROW 策略為全有或全無
+// DISCARD / CALLER_RUNS 在佇列滿時停止放入，剩下的任務在鎖外放棄或由呼叫端執行
+void EDFScheduler::addTasks(std::span<Task> tasks, Deadline deadline)
+{
+    if (tasks.empty()) return;
+
+    const int64_t deadlineNs = toNs(deadline);
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    if (rejectPolicy_ == RejectPolicy::THROW && maxQueueSize_ > 0 &&
+        heap_.size() + tasks.size() > maxQueueSize_)
+        throw TaskRejected("[EDFScheduler] Task batch rejected (queue full)");
+
+    size_t pushed = 0;
+    size_t accepted = 0;
+    std::vector<Task> evicted;
+
+    for (; accepted < tasks.size(); ++accepted)
+    {
+        if (maxQueueSize_ > 0 && heap_.size() >= maxQueueSize_)
+        {
+            if (rejectPolicy_ == RejectPolicy::DISCARD || rejectPolicy_ == RejectPolicy::CALLER_RUNS)
+                break;
+
+            if (rejectPolicy_ == RejectPolicy::DROP_OLDEST)
+                evicted.push_back(evictLocked());
+            else
+            {
+                // BLOCK：先讓工作執行緒消化已放入的任務，再等待空間
+                idle_.notify(pushed);
+                pushed = 0;
+                cvFull_.wait(lock, [this] {
+                    return heap_.size() < maxQueueSize_ || !running_.load(std::memory_order_relaxed);
+                });
+                if (!running_.load(std::memory_order_relaxed))
+                    break;
+            }
+        }
+
+        pushLocked(std::move(tasks[accepted]), deadlineNs);
+        ++pushed;
+    }
+
+    const RejectPolicy policy = rejectPolicy_;
+    lock.unlock();
+    idle_.notify(pushed);
+
+    const size_t overflow = tasks.size() - accepted;
+    if (overflow > 0 && policy == RejectPolicy::DISCARD)
+        LOG_WARN("[EDFScheduler] {} tasks discarded (queue full)", overflow);
+    if (!evicted.empty())
+        LOG_WARN("[EDFScheduler] {} tasks evicted (queue full, DROP_OLDEST)", evicted.size());
+    LOG_DEBUG("[EDFScheduler] {} tasks pushed", accepted);
+
+    for (Task& task : evicted)
+        detail::rejectTask(task, "[EDFScheduler] Task evicted (queue full, DROP_OLDEST)");
+    if (policy == RejectPolicy::BLOCK)
+    {
+        // BLOCK 只有在等待空間時 pool 停止才會剩下任務
+        for (Task& task : tasks.subspan(accepted))
+            detail::rejectTask(task, "[EDFScheduler] Task rejected (pool stopped)");
+        return;
+    }
+    detail::handleOverflow(policy, tasks.subspan(accepted), "[EDFScheduler] Task discarded (queue full)");
+}
+
+void EDFScheduler::addTasks(std::span<Task> tasks)
+{  addTasks(tasks, Deadline::max());  }
+
+// 呼叫端須持有 mutex_；依期限取出，已過期的放棄後繼續取，佇列取空時回傳空任務
+// 過期的任務必定集中在 heap 頂端，因此超載時的清除不會掃描整個佇列
+Task EDFScheduler::takeLive(std::unique_lock<std::mutex>& lock)
+{
+    const int64_t now = nowNs();
+    while (!heap_.empty())
+    {
+        Entry entry = popLocked();
+        cvFull_.notify_one();
+
+        if (entry.deadlineNs >= now)
+            return std::move(entry.task);
+
+        // 放棄時會呼叫 future 的 set_exception 與閉包的解構，不在鎖內進行
+        lock.unlock();
+        expire(std::move(entry.task));
+        lock.lock();
+    }
+    return {};
+}
+
+void EDFScheduler::expire(Task task)
+{
+    expired_.fetch_add(1, std::memory_order_relaxed);
+    LOG_DEBUG("[EDFScheduler] Task dropped (deadline expired)");
+    task.fail(std::make_exception_ptr(DeadlineExpired{}));
+}
+
+bool EDFScheduler::hasWork() const
+{  return queued_.load(std::memory_order_relaxed) > 0 || !running_.load(std::memory_order_relaxed);  }
+
+// 佇列只剩過期任務時會全部放棄後回傳 false 繼續等待；停止且佇列已空時回傳 true（task 保持為空）
+bool EDFScheduler::tryTake(Task& task)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!heap_.empty())
+        task = takeLive(lock);
+    return task || !running_.load(std::memory_order_relaxed);
+}
+
+Task EDFScheduler::getTask()
+{
+    Task task;
+    idle_.wait([this] { return hasWork(); }, [&] { return tryTake(task); });
+    return task;
+}
+
+Task EDFScheduler::getTaskFor(std::chrono::milliseconds timeout)
+{
+    Task task;
+    idle_.waitUntil([this] { return hasWork(); }, [&] { return tryTake(task); },
+                    IdleWaiter::Clock::now() + timeout);
+    return task;
+}
+
+void EDFScheduler::reportStatus()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::cout << "[EDFScheduler] Tasks in queue: " << heap_.size()
+              << ", expired: " << expired_.load(std::memory_order_relaxed) << std::endl;
+}
+
+void EDFScheduler::notifyAll()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    idle_.notifyAll();
+    cvFull_.notify_all();   // 等待空間的 BLOCK 生產者放棄任務後返回
+}
+
+void EDFScheduler::setRejectPolicy(RejectPolicy policy)
+{  rejectPolicy_ = policy;  }
+
+void EDFScheduler::setMaxQueueSize(size_t maxSize)
+{  maxQueueSize_ = maxSize;  }
+
+size_t EDFScheduler::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return heap_.size();
+}
+
+} // namespace ConcurrentEngine::Scheduler
@@ -1,5 +1,7 @@
 #include <threadPool/scheduler/PriorityScheduler.hpp>
+#include <bit>
 #include <stdexcept>
+#include <vector>
 
 namespace ConcurrentEngine::Scheduler 
 {
@@ -9,22 +11,112 @@ PriorityScheduler::PriorityScheduler()
       rejectPolicy_(RejectPolicy::BLOCK),
       maxQueueSize_(0),
       currentTaskCount_(0)
+{}
+
+// 呼叫端須持有 mutex_：只有一個寫入者，不需要原子的讀改寫
+void PriorityScheduler::adjustCount(std::ptrdiff_t delta)
+{  currentTaskCount_.store(currentTaskCount_.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);  }
+
+void PriorityScheduler::setAging(std::chrono::nanoseconds threshold, unsigned step)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const bool wasEnabled = agingNs_ > 0;
+    agingNs_ = std::max<int64_t>(0, threshold.count());
+    agingStep_ = std::max(1u, step);
+    nextAgingNs_ = 0;
+
+    // 關閉期間放入的任務沒有記錄時間，視為在開啟的這一刻進入，而不是一開啟就全部被提升
+    if (!wasEnabled && agingNs_ > 0)
+        agingStartNs_ = agingClock();
+}
+
+// 未開啟 aging 時不讀時鐘
+int64_t PriorityScheduler::agingClock() const
+{  return agingNs_ > 0 ? std::chrono::steady_clock::now().time_since_epoch().count() : 0;  }
+
+// 呼叫端須持有 mutex_
+void PriorityScheduler::pushLocked(Task&& task, PriorityLevel level, int64_t nowNs)
 {
-    queues_[TaskPriority::HIGH] = std::queue<Task>{};
-    queues_[TaskPriority::MEDIUM] = std::queue<Task>{};
-    queues_[TaskPriority::LOW] = std::queue<Task>{};
+    queues_[level].push({std::move(task), nowNs});
+    markNonEmpty(level);
 }
 
-size_t PriorityScheduler::totalQueueSize() const 
+// 呼叫端須持有 mutex_；全空時回傳 -1
+int PriorityScheduler::highestNonEmpty() const
 {
-    return queues_.at(TaskPriority::HIGH).size()
-         + queues_.at(TaskPriority::MEDIUM).size()
-         + queues_.at(TaskPriority::LOW).size();
+    for (size_t word = 0; word < nonEmpty_.size(); ++word)
+    {
+        if (nonEmpty_[word] != 0)
+            return static_cast<int>(word * 64) + std::countr_zero(nonEmpty_[word]);
+    }
+    return -1;
 }
 
-void PriorityScheduler::addTask(Task task, TaskPriority priority)
+// 呼叫端須持有 mutex_；全空時回傳 -1
+int PriorityScheduler::lowestNonEmpty() const
+{
+    for (size_t word = nonEmpty_.size(); word-- > 0;)
+    {
+        if (nonEmpty_[word] != 0)
+            return static_cast<int>(word * 64) + 63 - std::countl_zero(nonEmpty_[word]);
+    }
+    return -1;
+}
+
+// 呼叫端須持有 mutex_ 且佇列非空；DROP_OLDEST 用：取出最低優先級中最舊的任務
+Task PriorityScheduler::evictLocked()
+{
+    const auto level = static_cast<PriorityLevel>(lowestNonEmpty());
+    auto& queue = queues_[level];
+    Task task = std::move(queue.front().task);
+    queue.pop();
+    if (queue.empty())
+        markEmpty(level);
+
+    adjustCount(-1);
+    return task;
+}
+
+// 呼叫端須持有 mutex_
+// 每條佇列依 sinceNs 由舊到新排列，只需從前端取出等待超過門檻的任務，移到高 step 級的佇列尾端
+// sinceNs 早於 agingStartNs_ 的任務（開啟 aging 前放入）從 agingStartNs_ 起算
+void PriorityScheduler::ageLocked(int64_t nowNs)
+{
+    nextAgingNs_ = nowNs + std::max<int64_t>(1, agingNs_ / 4);
+
+    size_t promoted = 0;
+    for (size_t word = 0; word < nonEmpty_.size(); ++word)
+    {
+        uint64_t bits = nonEmpty_[word];
+        if (word == 0)
+            bits &= ~uint64_t{1};   // 最高級無從提升
+
+        while (bits != 0)
+        {
+            const auto level = static_cast<PriorityLevel>(word * 64 + std::countr_zero(bits));
+            bits &= bits - 1;
+
+            const auto target = static_cast<PriorityLevel>(level > agingStep_ ? level - agingStep_ : 0);
+            auto& queue = queues_[level];
+            while (!queue.empty() && nowNs - std::max(queue.front().sinceNs, agingStartNs_) >= agingNs_)
+            {
+                pushLocked(std::move(queue.front().task), target, nowNs);
+                queue.pop();
+                ++promoted;
+            }
+            if (queue.empty())
+                markEmpty(level);
+        }
+    }
+
+    if (promoted > 0)
+        LOG_DEBUG("[PriorityScheduler] Aging promoted {} tasks", promoted);
+}
+
+void PriorityScheduler::addTask(Task task, Priority priority)
 {
     std::unique_lock<std::mutex> lock(mutex_);
+    Task evicted;
 
     if (maxQueueSize_ > 0 && currentTaskCount_ >= maxQueueSize_) 
     {
@@ -32,52 +124,206 @@ void PriorityScheduler::addTask(Task task, TaskPriority priority)
         {
             case RejectPolicy::BLOCK:
                 cvFull_.wait(lock, [this] {
-                    return currentTaskCount_ < maxQueueSize_;
+                    return currentTaskCount_ < maxQueueSize_ || !running_.load(std::memory_order_relaxed);
                 });
+                if (!running_.load(std::memory_order_relaxed))
+                {
+                    lock.unlock();
+                    detail::rejectTask(task, "[PriorityScheduler] Task rejected (pool stopped)");
+                    return;
+                }
                 break;
             case RejectPolicy::DISCARD:
-                std::cout << "[PriorityScheduler] Task discarded (queue full)\n";
+                lock.unlock();
+                LOG_WARN("[PriorityScheduler] Task discarded (queue full)");
+                detail::rejectTask(task, "[PriorityScheduler] Task discarded (queue full)");
                 return;
             case RejectPolicy::THROW:
-                throw std::runtime_error("[PriorityScheduler] Task rejected (queue full)");
+                throw TaskRejected("[PriorityScheduler] Task rejected (queue full)");
+            case RejectPolicy::CALLER_RUNS:
+                lock.unlock();
+                task();
+                return;
+            case RejectPolicy::DROP_OLDEST:
+                evicted = evictLocked();
+                break;
         }
     }
 
-    queues_[priority].push(std::move(task));
-    ++currentTaskCount_;
-    std::cout << "[PriorityScheduler] Task pushed to priority "
-              << static_cast<int>(priority) << "\n";
+    pushLocked(std::move(task), priority.level, agingClock());
+    adjustCount(1);
+    LOG_DEBUG("[PriorityScheduler] Task pushed to priority {}", static_cast<int>(priority.level));
 
     lock.unlock();
-    cv_.notify_one();
+    idle_.notify();
+
+    if (evicted)
+        detail::rejectTask(evicted, "[PriorityScheduler] Task evicted (queue full, DROP_OLDEST)");
 }
 
 void PriorityScheduler::addTask(Task task) 
 {  addTask(std::move(task), TaskPriority::MEDIUM); }
 
-Task PriorityScheduler::getTask()
+SubmitStatus PriorityScheduler::tryAddTask(Task& task, Priority priority)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (maxQueueSize_ > 0 && currentTaskCount_ >= maxQueueSize_)
+            return SubmitStatus::QUEUE_FULL;
+
+        pushLocked(std::move(task), priority.level, agingClock());
+        adjustCount(1);
+    }
+    idle_.notify();
+    return SubmitStatus::ACCEPTED;
+}
+
+SubmitStatus PriorityScheduler::tryAddTask(Task& task)
+{  return tryAddTask(task, TaskPriority::MEDIUM);  }
+
+size_t PriorityScheduler::tryAddTasks(std::span<Task> tasks, Priority priority)
+{
+    size_t accepted = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const int64_t nowNs = agingClock();
+        for (; accepted < tasks.size(); ++accepted)
+        {
+            if (maxQueueSize_ > 0 && currentTaskCount_ >= maxQueueSize_)
+                break;
+            pushLocked(std::move(tasks[accepted]), priority.level, nowNs);
+            adjustCount(1);
+        }
+    }
+    if (accepted > 0)
+        idle_.notify(accepted);
+    return accepted;
+}
+
+size_t PriorityScheduler::tryAddTasks(std::span<Task> tasks)
+{  return tryAddTasks(tasks, TaskPriority::MEDIUM);  }
+
+// 整批放入同一優先級，只取一次鎖；THROW 策略為全有或全無
+// DISCARD / CALLER_RUNS 在佇列滿時停止放入，剩下的任務在鎖外放棄或由呼叫端執行
+void PriorityScheduler::addTasks(std::span<Task> tasks, Priority priority)
 {
+    if (tasks.empty()) return;
+
     std::unique_lock<std::mutex> lock(mutex_);
-    cv_.wait(lock, [this] {
-        return totalQueueSize() > 0 || !running_;
-    });
 
-    if (!running_ && totalQueueSize() == 0)
-        return {};
+    if (rejectPolicy_ == RejectPolicy::THROW && maxQueueSize_ > 0 &&
+        currentTaskCount_ + tasks.size() > maxQueueSize_)
+        throw TaskRejected("[PriorityScheduler] Task batch rejected (queue full)");
+
+    const int64_t nowNs = agingClock();
+    size_t pushed = 0;
+    size_t accepted = 0;
+    std::vector<Task> evicted;
 
-    for (auto p : {TaskPriority::HIGH, TaskPriority::MEDIUM, TaskPriority::LOW}) 
+    for (; accepted < tasks.size(); ++accepted)
     {
-        if (!queues_[p].empty()) 
+        if (maxQueueSize_ > 0 && currentTaskCount_ >= maxQueueSize_)
         {
-            Task task = std::move(queues_[p].front());
-            queues_[p].pop();
-            --currentTaskCount_;
-            cvFull_.notify_one();
-            return task;
+            if (rejectPolicy_ == RejectPolicy::DISCARD || rejectPolicy_ == RejectPolicy::CALLER_RUNS)
+                break;
+
+            if (rejectPolicy_ == RejectPolicy::DROP_OLDEST)
+                evicted.push_back(evictLocked());
+            else
+            {
+                // BLOCK：先讓工作執行緒消化已放入的任務，再等待空間
+                idle_.notify(pushed);
+                pushed = 0;
+                cvFull_.wait(lock, [this] {
+                    return currentTaskCount_ < maxQueueSize_ || !running_.load(std::memory_order_relaxed);
+                });
+                if (!running_.load(std::memory_order_relaxed))
+                    break;
+            }
         }
+
+        pushLocked(std::move(tasks[accepted]), priority.level, nowNs);
+        adjustCount(1);
+        ++pushed;
     }
 
-    return {};
+    const RejectPolicy policy = rejectPolicy_;
+    lock.unlock();
+    idle_.notify(pushed);
+
+    const size_t overflow = tasks.size() - accepted;
+    if (overflow > 0 && policy == RejectPolicy::DISCARD)
+        LOG_WARN("[PriorityScheduler] {} tasks discarded (queue full)", overflow);
+    if (!evicted.empty())
+        LOG_WARN("[PriorityScheduler] {} tasks evicted (queue full, DROP_OLDEST)", evicted.size());
+    LOG_DEBUG("[PriorityScheduler] {} tasks pushed to priority {}", accepted, static_cast<int>(priority.level));
+
+    for (Task& task : evicted)
+        detail::rejectTask(task, "[PriorityScheduler] Task evicted (queue full, DROP_OLDEST)");
+    if (policy == RejectPolicy::BLOCK)
+    {
+        // BLOCK 只有在等待空間時 pool 停止才會剩下任務
+        for (Task& task : tasks.subspan(accepted))
+            detail::rejectTask(task, "[PriorityScheduler] Task rejected (pool stopped)");
+        return;
+    }
+    detail::handleOverflow(policy, tasks.subspan(accepted), "[PriorityScheduler] Task discarded (queue full)");
+}
+
+void PriorityScheduler::addTasks(std::span<Task> tasks)
+{  addTasks(tasks, TaskPriority::MEDIUM);  }
+
+bool PriorityScheduler::hasWork() const
+{  return totalQueueSize() > 0 || !running_.load(std::memory_order_relaxed);  }
+
+// 停止後仍會先取完剩下的任務，佇列空了才回傳 true（task 保持為空）
+bool PriorityScheduler::tryTake(Task& task)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (totalQueueSize() == 0)
+        return !running_.load(std::memory_order_relaxed);
+
+    task = popHighest();
+    return true;
+}
+
+Task PriorityScheduler::getTask()
+{
+    Task task;
+    idle_.wait([this] { return hasWork(); }, [&] { return tryTake(task); });
+    return task;
+}
+
+Task PriorityScheduler::getTaskFor(std::chrono::milliseconds timeout)
+{
+    Task task;
+    idle_.waitUntil([this] { return hasWork(); }, [&] { return tryTake(task); },
+                    IdleWaiter::Clock::now() + timeout);
+    return task;
+}
+
+// 呼叫端須持有 mutex_；佇列全空時回傳空任務
+Task PriorityScheduler::popHighest()
+{
+    if (totalQueueSize() == 0) return {};
+
+    if (agingNs_ > 0)
+    {
+        const int64_t nowNs = agingClock();
+        if (nowNs >= nextAgingNs_)
+            ageLocked(nowNs);
+    }
+
+    const auto level = static_cast<PriorityLevel>(highestNonEmpty());
+    auto& queue = queues_[level];
+    Task task = std::move(queue.front().task);
+    queue.pop();
+    if (queue.empty())
+        markEmpty(level);
+
+    adjustCount(-1);
+    cvFull_.notify_one();
+    return task;
 }
 
 void PriorityScheduler::reportStatus()
@@ -85,11 +331,16 @@ void PriorityScheduler::reportStatus()
     std::lock_guard<std::mutex> lock(mutex_);
     size_t total = totalQueueSize();
 
-    std::cout << "[PriorityScheduler] Queue Status:\n"
-              << "  - HIGH   : " << queues_[TaskPriority::HIGH].size() << "\n"
-              << "  - MEDIUM : " << queues_[TaskPriority::MEDIUM].size() << "\n"
-              << "  - LOW    : " << queues_[TaskPriority::LOW].size() << "\n"
-              << "  - TOTAL  : " << total << "\n";
+    std::cout << "[PriorityScheduler] Queue Status:\n";
+    for (size_t level = 0; level < kPriorityLevels; ++level)
+    {
+        if (!queues_[level].empty())
+            std::cout << "  - level " << level << " : " << queues_[level].size() << "\n";
+    }
+    std::cout << "  - TOTAL  : " << total;
+    if (agingNs_ > 0)
+        std::cout << " (aging every " << agingNs_ / 1000 << " us by " << agingStep_ << " levels)";
+    std::cout << "\n";
 }
 
 void PriorityScheduler::notifyAll()
@@ -98,7 +349,8 @@ void PriorityScheduler::notifyAll()
         std::lock_guard<std::mutex> lock(mutex_);
         running_ = false;
     }
-    cv_.notify_all();
+    idle_.notifyAll();
+    cvFull_.notify_all();   // 等待空間的 BLOCK 生產者放棄任務後返回
 }
 
 void PriorityScheduler::setRejectPolicy(RejectPolicy policy)
@@ -120,6 +372,12 @@ void PriorityScheduler::getRejectPolicy() const
         case RejectPolicy::THROW:
             std::cout << "[PriorityScheduler] RejectPolicy THROW\n";
             break;
+        case RejectPolicy::CALLER_RUNS:
+            std::cout << "[PriorityScheduler] RejectPolicy CALLER_RUNS\n";
+            break;
+        case RejectPolicy::DROP_OLDEST:
+            std::cout << "[PriorityScheduler] RejectPolicy DROP_OLDEST\n";
+            break;
     }
 }
 
@@ -0,0 +1,318 @@
+#include <threadPool/scheduler/taskGraph.hpp>
+#include <threadPool/core/future.hpp>
+#include <threadPool/logger/threadLogger.hpp>
+#include <algorithm>
+#include <stdexcept>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+TaskGraph::NodeId TaskGraph::addNode(Task task, std::string name)
+{
+    ensureIdle();
+    nodes_.push_back({std::move(task), std::move(name)});
+    compiled_ = false;
+    return nodes_.size() - 1;
+}
+
+void TaskGraph::precede(NodeId before, NodeId after)
+{
+    ensureIdle();
+    edges_.emplace_back(before, after);
+    compiled_ = false;
+}
+
+void TaskGraph::setCostHint(NodeId id, std::chrono::nanoseconds cost)
+{
+    ensureIdle();
+    Node& node = nodes_.at(id);
+    node.estimateNs = static_cast<double>(std::max<int64_t>(1, cost.count()));
+    node.measured = false;
+    if (compiled_)
+        updateRanks();
+}
+
+void TaskGraph::ensureIdle() const
+{
+    if (running_.load(std::memory_order_acquire))
+        throw std::runtime_error("[TaskGraph] Cannot modify a graph while it is running");
+}
+
+bool TaskGraph::compile()
+{
+    ensureIdle();
+    compiled_ = false;
+
+    const size_t n = nodes_.size();
+    for (NodeId i = 0; i < n; ++i)
+    {
+        if (!nodes_[i].task)
+        {
+            LOG_ERROR("[TaskGraph] Node {} has an empty task", i);
+            return false;
+        }
+    }
+
+    // 依來源節點計數後做前綴和，得到 CSR 結構
+    succOffsets_.assign(n + 1, 0);
+    initialPending_.assign(n, 0);
+    for (const auto& [from, to] : edges_)
+    {
+        if (from >= n || to >= n || from == to)
+        {
+            LOG_ERROR("[TaskGraph] Invalid edge {} -> {} ({} nodes)", from, to, n);
+            return false;
+        }
+        ++succOffsets_[from + 1];
+        ++initialPending_[to];
+    }
+    for (size_t i = 0; i < n; ++i)
+        succOffsets_[i + 1] += succOffsets_[i];
+
+    successors_.assign(edges_.size(), 0);
+    std::vector<size_t> fill(succOffsets_.begin(), succOffsets_.end() - 1);
+    for (const auto& [from, to] : edges_)
+        successors_[fill[from]++] = to;
+
+    // Kahn 拓樸排序：無法全部走訪代表有循環
+    roots_.clear();
+    std::vector<int> pending = initialPending_;
+    std::vector<NodeId> order;
+    order.reserve(n);
+    for (NodeId i = 0; i < n; ++i)
+    {
+        if (pending[i] == 0)
+        {
+            roots_.push_back(i);
+            order.push_back(i);
+        }
+    }
+    for (size_t k = 0; k < order.size(); ++k)
+    {
+        NodeId id = order[k];
+        for (size_t e = succOffsets_[id]; e < succOffsets_[id + 1]; ++e)
+        {
+            if (--pending[successors_[e]] == 0)
+                order.push_back(successors_[e]);
+        }
+    }
+    if (order.size() != n)
+    {
+        LOG_ERROR("[TaskGraph] Cycle detected: {} of {} nodes are unreachable", n - order.size(), n);
+        return false;
+    }
+    topoOrder_ = std::move(order);
+
+    pending_ = std::make_unique<std::atomic<int>[]>(n);
+    durationNs_ = std::make_unique<int64_t[]>(n);
+    pathNs_ = std::make_unique<std::atomic<int64_t>[]>(n);
+    rank_.assign(n, 0.0);
+    updateRanks();
+    rootTasks_.clear();
+    rootTasks_.reserve(roots_.size());
+
+    compiled_ = true;
+    LOG_INFO("[TaskGraph] Compiled {} nodes, {} edges, {} roots", n, edges_.size(), roots_.size());
+    return true;
+}
+
+void TaskGraph::execute(void* ctx, Dispatch dispatch, size_t workers)
+{
+    if (!compiled_)
+        throw std::runtime_error("[TaskGraph] Graph must be compiled before it is run");
+    if (running_.exchange(true, std::memory_order_acq_rel))
+        throw std::runtime_error("[TaskGraph] Graph is already running");
+
+    const size_t n = nodes_.size();
+    if (n == 0)
+    {
+        running_.store(false, std::memory_order_release);
+        return;
+    }
+
+    // 整批重設計數，之後的 dispatch 會讓工作執行緒看到這些值
+    for (size_t i = 0; i < n; ++i)
+    {
+        pending_[i].store(initialPending_[i], std::memory_order_relaxed);
+        pathNs_[i].store(0, std::memory_order_relaxed);
+    }
+    remaining_.store(n, std::memory_order_relaxed);
+    failed_.store(false, std::memory_order_relaxed);
+    error_ = nullptr;
+    done_ = false;
+    ctx_ = ctx;
+    dispatch_ = dispatch;
+
+    const int64_t beginNs = std::chrono::steady_clock::now().time_since_epoch().count();
+
+    // rank 最高的 root 由呼叫端執行，其餘依 rank 順序一次交給 Scheduler
+    for (size_t i = 1; i < roots_.size(); ++i)
+        rootTasks_.emplace_back(nodeTask(roots_[i]));
+    if (!rootTasks_.empty())
+    {
+        try
+        {  dispatch_(ctx_, std::span<Task>(rootTasks_));  }
+        catch (const std::exception& e)
+        {  LOG_WARN("[TaskGraph] Dispatch failed, running roots inline: {}", e.what());  }
+
+        // 被拒絕（仍留在 rootTasks_ 中）的 root 就地執行
+        for (Task& task : rootTasks_)
+        {
+            if (task)
+                task();
+        }
+        rootTasks_.clear();
+    }
+
+    runNode(roots_.front());
+
+    {
+        std::unique_lock<std::mutex> lock(doneMutex_);
+        doneCv_.wait(lock, [this] { return done_; });
+    }
+
+    collectStats(beginNs, workers + 1);
+    updateRanks();
+
+    std::exception_ptr error = std::move(error_);
+    error_ = nullptr;
+    running_.store(false, std::memory_order_release);
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+// 執行節點後釋放後繼：第一個就緒的後繼直接在這條執行緒接著跑，其餘交給 Scheduler
+// 所有對 graph 的存取都在 finishOne() 之前完成，最後一個節點完成後 execute() 即可返回
+void TaskGraph::runNode(NodeId id)
+{
+    while (id != npos)
+    {
+        const int64_t startNs = std::chrono::steady_clock::now().time_since_epoch().count();
+
+        // 發生例外後其餘節點只做計數、不再執行
+        if (!failed_.load(std::memory_order_relaxed))
+        {
+            try
+            {  nodes_[id].task();  }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(doneMutex_);
+                if (!error_)
+                    error_ = std::current_exception();
+                failed_.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        // 前驅已把各自的路徑長度寫進 pathNs_[id]（在釋放本節點的 fetch_sub 之前）
+        const int64_t duration = std::chrono::steady_clock::now().time_since_epoch().count() - startNs;
+        const int64_t path = pathNs_[id].load(std::memory_order_relaxed) + duration;
+        durationNs_[id] = duration;
+        pathNs_[id].store(path, std::memory_order_relaxed);
+
+        // successors_ 依 rank 由大到小排列，第一個就緒的就是剩餘路徑最長的
+        NodeId next = npos;
+        for (size_t e = succOffsets_[id]; e < succOffsets_[id + 1]; ++e)
+        {
+            NodeId succ = successors_[e];
+
+            int64_t seen = pathNs_[succ].load(std::memory_order_relaxed);
+            while (seen < path && !pathNs_[succ].compare_exchange_weak(seen, path, std::memory_order_relaxed))
+            {}
+
+            if (pending_[succ].fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                if (next == npos)
+                    next = succ;
+                else
+                    dispatchNode(succ);
+            }
+        }
+
+        finishOne();
+        id = next;
+    }
+}
+
+// 派送出去的節點一定會執行一次：即使在佇列中被放棄（fail）或沒有執行就解構，也會在當下的執行緒執行，
+// 否則後繼永遠不會就緒，execute() 也不會返回
+Task TaskGraph::nodeTask(NodeId id)
+{  return Task(ConcurrentEngine::detail::Continuation([this, id] { runNode(id); }));  }
+
+void TaskGraph::dispatchNode(NodeId id)
+{
+    Task task = nodeTask(id);
+    try
+    {  dispatch_(ctx_, std::span<Task>(&task, 1));  }
+    catch (const std::exception& e)
+    {  LOG_WARN("[TaskGraph] Dispatch failed, running node {} inline: {}", id, e.what());  }
+
+    if (task)
+        task();
+}
+
+void TaskGraph::finishOne()
+{
+    if (remaining_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        std::lock_guard<std::mutex> lock(doneMutex_);
+        done_ = true;
+        doneCv_.notify_all();
+    }
+}
+
+// 依目前的估計重新計算每個節點到終點的最長剩餘路徑（反向拓樸順序），
+// 並把各節點的後繼與 roots 依 rank 由大到小排序；只在沒有執行時呼叫，不配置記憶體
+void TaskGraph::updateRanks()
+{
+    for (auto it = topoOrder_.rbegin(); it != topoOrder_.rend(); ++it)
+    {
+        NodeId id = *it;
+        double longest = 0.0;
+        for (size_t e = succOffsets_[id]; e < succOffsets_[id + 1]; ++e)
+            longest = std::max(longest, rank_[successors_[e]]);
+        rank_[id] = nodes_[id].estimateNs + longest;
+    }
+
+    auto byRank = [this](NodeId a, NodeId b) { return rank_[a] > rank_[b]; };
+    for (size_t i = 0; i < nodes_.size(); ++i)
+        std::sort(successors_.begin() + static_cast<std::ptrdiff_t>(succOffsets_[i]),
+                  successors_.begin() + static_cast<std::ptrdiff_t>(succOffsets_[i + 1]), byRank);
+    std::sort(roots_.begin(), roots_.end(), byRank);
+}
+
+// 彙整這次執行的量測並更新估計：之後的實測以 1/4 權重平滑，避免單次抖動打亂排序
+void TaskGraph::collectStats(int64_t beginNs, size_t participants)
+{
+    const int64_t endNs = std::chrono::steady_clock::now().time_since_epoch().count();
+
+    int64_t work = 0;
+    int64_t critical = 0;
+    for (size_t i = 0; i < nodes_.size(); ++i)
+    {
+        work += durationNs_[i];
+        critical = std::max(critical, pathNs_[i].load(std::memory_order_relaxed));
+
+        // 第一次實測直接取代估計值
+        const double measured = static_cast<double>(std::max<int64_t>(1, durationNs_[i]));
+        if (nodes_[i].measured)
+            nodes_[i].estimateNs += (measured - nodes_[i].estimateNs) * 0.25;
+        else
+            nodes_[i].estimateNs = measured;
+        nodes_[i].measured = true;
+    }
+
+    lastRun_.makespan = std::chrono::nanoseconds(endNs - beginNs);
+    lastRun_.criticalPath = std::chrono::nanoseconds(critical);
+    lastRun_.work = std::chrono::nanoseconds(work);
+    lastRun_.participants = participants;
+    lastRun_.utilization = lastRun_.makespan.count() > 0
+        ? static_cast<double>(work) / (static_cast<double>(lastRun_.makespan.count()) * static_cast<double>(participants))
+        : 0.0;
+
+    LOG_INFO("[TaskGraph] Run: makespan {} us, critical path {} us, work {} us, utilization {}%",
+             lastRun_.makespan.count() / 1000, critical / 1000, work / 1000,
+             static_cast<int>(lastRun_.utilization * 100));
+}
+
+} // namespace ConcurrentEngine::Scheduler
@@ -0,0 +1,311 @@
+#include <threadPool/scheduler/WorkStealingScheduler.hpp>
+#include <threadPool/core/cpuTopology.hpp>
+#include <threadPool/core/recyclingAllocator.hpp>
+#include <new>
+#include <thread>
+
+namespace ConcurrentEngine::Scheduler
+{
+
+namespace
+{
+
+// 目前執行緒綁定的 scheduler 與 slot（非工作執行緒為 nullptr）
+struct WorkerBinding
+{
+    const WorkStealingScheduler* owner = nullptr;
+    size_t slot = 0;
+};
+
+thread_local WorkerBinding tlsBinding;
+
+// 竊取時挑選 victim 用的 xorshift 亂數
+uint32_t nextRandom()
+{
+    thread_local uint32_t state =
+        static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id())) | 1u;
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+// 佇列中的任務節點：deque 只能存放指標，節點以 RecyclingAllocator 回收，
+// 工作執行緒取出後釋放的區塊會留給它之後產生的子任務，穩定狀態下不需 malloc
+Task* newItem(Task&& task)
+{
+    Task* item = RecyclingAllocator<Task>{}.allocate(1);
+    return ::new (static_cast<void*>(item)) Task(std::move(task));
+}
+
+void deleteItem(Task* item) noexcept
+{
+    item->~Task();
+    RecyclingAllocator<Task>{}.deallocate(item, 1);
+}
+
+} // namespace
+
+WorkStealingScheduler::WorkStealingScheduler(size_t maxWorkers)
+{
+    slots_.reserve(maxWorkers);
+    for (size_t i = 0; i < maxWorkers; ++i)
+        slots_.push_back(std::make_unique<WorkerSlot>());
+
+    const size_t nodes = CpuTopology::get().nodeCount();
+    for (size_t i = 0; i < nodes; ++i)
+        injectQueues_.push_back(std::make_unique<InjectQueue>());
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    for (auto& slot : slots_)
+    {
+        while (auto item = slot->deque.steal())
+            deleteItem(*item);
+    }
+
+    for (auto& inject : injectQueues_)
+    {
+        while (!inject->queue.empty())
+        {
+            deleteItem(inject->queue.front());
+            inject->queue.pop();
+        }
+    }
+}
+
+size_t WorkStealingScheduler::currentSlot() const
+{  return tlsBinding.owner == this ? tlsBinding.slot : kNoSlot;  }
+
+// 工作執行緒用 slot 記錄的 node，外部執行緒依目前所在 CPU 判斷
+size_t WorkStealingScheduler::nodeOf(size_t slot) const
+{
+    if (injectQueues_.size() == 1) return 0;
+
+    int node = slot != kNoSlot ? slots_[slot]->node.load(std::memory_order_relaxed) : currentNumaNode();
+    return static_cast<size_t>(node) % injectQueues_.size();
+}
+
+void WorkStealingScheduler::onWorkerStart(const WorkerInfo& info)
+{
+    // 從 worker id 對應的位置開始找空的 slot，允許執行緒被回收後重用
+    const size_t count = slots_.size();
+    const size_t hint = info.id >= 0 ? static_cast<size_t>(info.id) % count : 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t idx = (hint + i) % count;
+        bool expected = false;
+        if (slots_[idx]->occupied.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+        {
+            tlsBinding = {this, idx};
+            slots_[idx]->node.store(info.numaNode >= 0 ? info.numaNode : currentNumaNode(),
+                                    std::memory_order_relaxed);
+
+            size_t high = slotHighWater_.load(std::memory_order_relaxed);
+            while (high < idx + 1 &&
+                   !slotHighWater_.compare_exchange_weak(high, idx + 1, std::memory_order_release))
+            {}
+            return;
+        }
+    }
+
+    // slot 用完：此執行緒仍可從 injection queue 取任務與竊取
+    std::cout << "[WorkStealingScheduler] No free worker slot for thread " << info.id << "\n";
+}
+
+void WorkStealingScheduler::onWorkerStop(const WorkerInfo&)
+{
+    size_t self = currentSlot();
+    if (self == kNoSlot) return;
+
+    // deque 中剩餘的任務仍可被其他執行緒竊取
+    slots_[self]->occupied.store(false, std::memory_order_release);
+    tlsBinding = {};
+}
+
+void WorkStealingScheduler::addTask(Task task)
+{
+    // 先遞增 pending_，避免竊取者先取走任務造成計數為負
+    pending_.fetch_add(1);
+
+    Task* item = newItem(std::move(task));
+    size_t self = currentSlot();
+
+    if (self != kNoSlot)
+    {
+        slots_[self]->deque.push(item);
+    }
+    else
+    {
+        InjectQueue& inject = *injectQueues_[nodeOf(kNoSlot)];
+        std::lock_guard<std::mutex> lock(inject.mutex);
+        inject.queue.push(item);
+        inject.size.fetch_add(1, std::memory_order_release);
+    }
+
+    idle_.notify();
+}
+
+void WorkStealingScheduler::addTasks(std::span<Task> tasks)
+{
+    if (tasks.empty()) return;
+
+    pending_.fetch_add(static_cast<int64_t>(tasks.size()));
+    size_t self = currentSlot();
+
+    if (self != kNoSlot)
+    {
+        for (Task& task : tasks)
+            slots_[self]->deque.push(newItem(std::move(task)));
+    }
+    else
+    {
+        InjectQueue& inject = *injectQueues_[nodeOf(kNoSlot)];
+        std::lock_guard<std::mutex> lock(inject.mutex);
+        for (Task& task : tasks)
+            inject.queue.push(newItem(std::move(task)));
+        inject.size.fetch_add(tasks.size(), std::memory_order_release);
+    }
+
+    idle_.notify(tasks.size());
+}
+
+// pending_ > 0 代表確實有任務（或即將放入），竊取因競爭失敗時重試，不能就此休眠
+// 停止且沒有剩餘任務時回傳 true（task 保持為空）
+bool WorkStealingScheduler::tryTake(size_t self, Task& task)
+{
+    do
+    {
+        if (Task* item = tryAcquire(self))
+        {
+            task = std::move(*item);
+            deleteItem(item);
+            return true;
+        }
+        if (pending_.load() <= 0)
+            return !running_.load(std::memory_order_relaxed);
+        std::this_thread::yield();
+    } while (true);
+}
+
+Task WorkStealingScheduler::getTask()
+{
+    const size_t self = currentSlot();
+    Task task;
+    idle_.wait([this] { return pending_.load(std::memory_order_relaxed) > 0 || !running_.load(std::memory_order_relaxed); },
+               [&] { return tryTake(self, task); });
+    return task;
+}
+
+Task WorkStealingScheduler::getTaskFor(std::chrono::milliseconds timeout)
+{
+    const size_t self = currentSlot();
+    Task task;
+    idle_.waitUntil([this] { return pending_.load(std::memory_order_relaxed) > 0 || !running_.load(std::memory_order_relaxed); },
+                    [&] { return tryTake(self, task); }, IdleWaiter::Clock::now() + timeout);
+    return task;
+}
+
+Task* WorkStealingScheduler::tryAcquire(size_t self)
+{
+    Task* item = nullptr;
+
+    if (self != kNoSlot)
+    {
+        if (auto local = slots_[self]->deque.pop())
+            item = *local;
+    }
+
+    const size_t node = nodeOf(self);
+
+    if (!item)
+        item = popInjected(node);
+
+    if (!item)
+        item = stealFrom(self, node);
+
+    if (item)
+        pending_.fetch_sub(1);
+
+    return item;
+}
+
+// 從自己 node 的 injection queue 開始，依序檢查其他 node
+Task* WorkStealingScheduler::popInjected(size_t node)
+{
+    const size_t count = injectQueues_.size();
+    for (size_t i = 0; i < count; ++i)
+    {
+        InjectQueue& inject = *injectQueues_[(node + i) % count];
+        if (inject.size.load(std::memory_order_acquire) == 0)
+            continue;
+
+        std::lock_guard<std::mutex> lock(inject.mutex);
+        if (inject.queue.empty())
+            continue;
+
+        Task* item = inject.queue.front();
+        inject.queue.pop();
+        inject.size.fetch_sub(1, std::memory_order_relaxed);
+        return item;
+    }
+    return nullptr;
+}
+
+// 第一輪只竊取同 node 的 victim，找不到才跨 node（單一 node 時只有一輪）
+Task* WorkStealingScheduler::stealFrom(size_t self, size_t node)
+{
+    const size_t count = slotHighWater_.load(std::memory_order_acquire);
+    if (count == 0) return nullptr;
+
+    const bool multiNode = injectQueues_.size() > 1;
+    const size_t start = nextRandom() % count;
+
+    for (int pass = multiNode ? 0 : 1; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            size_t victim = (start + i) % count;
+            if (victim == self) continue;
+            if (pass == 0 && nodeOf(victim) != node) continue;
+
+            if (auto stolen = slots_[victim]->deque.steal())
+                return *stolen;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingScheduler::reportStatus()
+{
+    std::cout << "[WorkStealingScheduler] Pending tasks: " << pending_.load() << "\n";
+
+    for (size_t i = 0; i < injectQueues_.size(); ++i)
+        std::cout << "  - Injection queue (node " << i << "): " << injectQueues_[i]->size.load() << "\n";
+
+    const size_t count = slotHighWater_.load(std::memory_order_acquire);
+    for (size_t i = 0; i < count; ++i)
+        std::cout << "  - Worker slot " << i << ": " << slots_[i]->deque.size() << "\n";
+}
+
+void WorkStealingScheduler::notifyAll()
+{
+    running_ = false;
+    idle_.notifyAll();
+}
+
+void WorkStealingScheduler::setRejectPolicy(RejectPolicy)
+{  std::cout << "[WorkStealingScheduler] RejectPolicy not applicable.\n";  }
+
+void WorkStealingScheduler::setMaxQueueSize(size_t)
+{  std::cout << "[WorkStealingScheduler] MaxQueueSize not used.\n";  }
+
+size_t WorkStealingScheduler::size() const
+{
+    int64_t n = pending_.load(std::memory_order_relaxed);
+    return n > 0 ? static_cast<size_t>(n) : 0;
+}
+
+} // namespace ConcurrentEngine::Scheduler